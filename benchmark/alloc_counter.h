@@ -0,0 +1,83 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/*
+核心定位: 统计堆分配次数、字节数和峰值占用，用于对比数据结构的内存开销
+实现方式：替换全局 operator new / delete，在每块内存前面放一个头部记录块大小
+注意：替换函数不能是 inline，本头文件只能被每个可执行文件中的一个 .cpp 包含
+*/
+
+namespace bench {
+
+struct AllocStats {
+    std::atomic<std::size_t> allocations{0};
+    std::atomic<std::size_t> bytes{0};        // 累计分配字节数
+    std::atomic<std::size_t> live_bytes{0};   // 当前未释放字节数
+    std::atomic<std::size_t> peak_bytes{0};   // live_bytes 的峰值
+};
+
+inline AllocStats g_alloc_stats;
+
+// 快照差值：构造时记下当前值，bytes()/allocations() 返回此后新增的量
+class AllocScope {
+public:
+    AllocScope()
+        : m_allocations_(g_alloc_stats.allocations.load()), m_bytes_(g_alloc_stats.bytes.load()) {
+        g_alloc_stats.peak_bytes.store(g_alloc_stats.live_bytes.load());
+        m_live_base_ = g_alloc_stats.live_bytes.load();
+    }
+
+    std::size_t allocations() const { return g_alloc_stats.allocations.load() - m_allocations_; }
+    std::size_t bytes() const { return g_alloc_stats.bytes.load() - m_bytes_; }
+    // 作用域内相对起点的峰值占用
+    std::size_t peakBytes() const { return g_alloc_stats.peak_bytes.load() - m_live_base_; }
+
+private:
+    std::size_t m_allocations_;
+    std::size_t m_bytes_;
+    std::size_t m_live_base_;
+};
+
+} // namespace bench
+
+namespace bench_detail {
+
+// 头部大小取最大对齐，保证返回给调用者的地址仍满足 new 的对齐要求
+constexpr std::size_t kHeader = alignof(std::max_align_t);
+
+inline void* countedAlloc(std::size_t size) {
+    void* raw = std::malloc(size + kHeader);
+    if (!raw) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(raw) = size;
+    bench::g_alloc_stats.allocations.fetch_add(1, std::memory_order_relaxed);
+    bench::g_alloc_stats.bytes.fetch_add(size, std::memory_order_relaxed);
+    std::size_t live = bench::g_alloc_stats.live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    std::size_t peak = bench::g_alloc_stats.peak_bytes.load(std::memory_order_relaxed);
+    while (live > peak && !bench::g_alloc_stats.peak_bytes.compare_exchange_weak(peak, live)) {
+    }
+    return static_cast<char*>(raw) + kHeader;
+}
+
+inline void countedFree(void* p) {
+    if (!p) {
+        return;
+    }
+    void* raw = static_cast<char*>(p) - kHeader;
+    bench::g_alloc_stats.live_bytes.fetch_sub(*static_cast<std::size_t*>(raw), std::memory_order_relaxed);
+    std::free(raw);
+}
+
+} // namespace bench_detail
+
+void* operator new(std::size_t size) { return bench_detail::countedAlloc(size); }
+void* operator new[](std::size_t size) { return bench_detail::countedAlloc(size); }
+void operator delete(void* p) noexcept { bench_detail::countedFree(p); }
+void operator delete[](void* p) noexcept { bench_detail::countedFree(p); }
+void operator delete(void* p, std::size_t) noexcept { bench_detail::countedFree(p); }
+void operator delete[](void* p, std::size_t) noexcept { bench_detail::countedFree(p); }
@@ -0,0 +1,56 @@
+#include <memory>
+#include <variant>
+#include <vector>
+#include "bench_common.h"
+#include "../多态/animal.h"
+
+// Animal 模块：虚函数动态分派 vs std::variant + std::visit 静态分派
+int main(int argc, char* argv[]) {
+    bench::Suite suite("animal", argc, argv);
+    const std::size_t kIters = 2000;
+    const std::size_t kCount = 256;
+
+    std::vector<std::unique_ptr<Animal>> boxed;
+    std::vector<std::variant<Dog, Cat>> variants;
+    {
+        bench::QuietStdout quiet;
+        for (std::size_t i = 0; i < kCount; i++) {
+            if (i % 2 == 0) {
+                boxed.push_back(std::make_unique<Dog>());
+                variants.emplace_back(Dog());
+            } else {
+                boxed.push_back(std::make_unique<Cat>());
+                variants.emplace_back(Cat());
+            }
+        }
+    }
+
+    suite.run("dispatch_x256/virtual", kIters, [&boxed] {
+        for (const auto& animal : boxed) {
+            animal->makeSound();
+        }
+        bench::clobberMemory();
+    });
+    suite.run("dispatch_x256/std::visit", kIters, [&variants] {
+        for (const auto& animal : variants) {
+            std::visit([](const auto& a) { a.makeSound(); }, animal);
+        }
+        bench::clobberMemory();
+    });
+    suite.run("lifetime/new_delete", kIters * 50, [] {
+        Animal* a = new Dog();
+        bench::doNotOptimize(a);
+        delete a;
+    });
+    suite.run("lifetime/std::make_unique", kIters * 50, [] {
+        std::unique_ptr<Animal> a = std::make_unique<Dog>();
+        bench::doNotOptimize(a.get());
+    });
+
+    {
+        bench::QuietStdout quiet;
+        boxed.clear();
+        variants.clear();
+    }
+    return suite.finish();
+}
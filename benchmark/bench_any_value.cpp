@@ -0,0 +1,163 @@
+#include <any>
+#include <string>
+#include <utility>
+#include <vector>
+#include "bench_common.h"
+#include "../模板类/any_value.h"
+#include "../智能指针/unique_ptr_design.h"
+
+// AnyValue：与 std::any、堆上装箱的 Unique_ptr<Base>（虚函数）对比 构造 / 拷贝 / 访问 的耗时
+
+// ===================== 对照组：经典的 "基类指针 + 虚函数" 装箱 =====================
+struct Base {
+    virtual ~Base() = default;
+    virtual Base* clone() const = 0;
+    virtual void accumulate(long long& sum) const = 0;
+};
+
+template<typename T>
+struct Boxed : Base {
+    T value;
+    explicit Boxed(T v) : value(std::move(v)) {}
+    Base* clone() const override { return new Boxed(value); }
+    void accumulate(long long& sum) const override;
+};
+
+template<>
+void Boxed<int>::accumulate(long long& sum) const { sum += value; }
+template<>
+void Boxed<double>::accumulate(long long& sum) const { sum += static_cast<long long>(value); }
+template<>
+void Boxed<std::string>::accumulate(long long& sum) const { sum += static_cast<long long>(value.size()); }
+
+int main(int argc, char* argv[]) {
+    bench::Suite suite("any_value", argc, argv);
+    const std::size_t kIters = 500000;
+    const std::string kText = "short text";
+
+    // ===================== 构造 + 析构 =====================
+    suite.run("construct_int/AnyValue", kIters, [] {
+        AnyValue v(42);
+        bench::doNotOptimize(v);
+    });
+    suite.run("construct_int/std::any", kIters, [] {
+        std::any v(42);
+        bench::doNotOptimize(v);
+    });
+    suite.run("construct_int/Unique_ptr<Base>", kIters, [] {
+        Unique_ptr<Base> v(new Boxed<int>(42));
+        bench::doNotOptimize(v);
+    });
+    suite.run("construct_string/AnyValue", kIters, [&kText] {
+        AnyValue v(kText);
+        bench::doNotOptimize(v);
+    });
+    suite.run("construct_string/std::any", kIters, [&kText] {
+        std::any v(kText);
+        bench::doNotOptimize(v);
+    });
+    suite.run("construct_string/Unique_ptr<Base>", kIters, [&kText] {
+        Unique_ptr<Base> v(new Boxed<std::string>(kText));
+        bench::doNotOptimize(v);
+    });
+
+    // ===================== 拷贝 =====================
+    const AnyValue any_int(42);
+    const std::any std_int(42);
+    const Boxed<int> boxed_int(42);
+    suite.run("copy_int/AnyValue", kIters, [&any_int] {
+        AnyValue v(any_int);
+        bench::doNotOptimize(v);
+    });
+    suite.run("copy_int/std::any", kIters, [&std_int] {
+        std::any v(std_int);
+        bench::doNotOptimize(v);
+    });
+    suite.run("copy_int/Unique_ptr<Base>", kIters, [&boxed_int] {
+        Unique_ptr<Base> v(boxed_int.clone());
+        bench::doNotOptimize(v);
+    });
+
+    const AnyValue any_str(kText);
+    const std::any std_str(kText);
+    const Boxed<std::string> boxed_str(kText);
+    suite.run("copy_string/AnyValue", kIters, [&any_str] {
+        AnyValue v(any_str);
+        bench::doNotOptimize(v);
+    });
+    suite.run("copy_string/std::any", kIters, [&std_str] {
+        std::any v(std_str);
+        bench::doNotOptimize(v);
+    });
+    suite.run("copy_string/Unique_ptr<Base>", kIters, [&boxed_str] {
+        Unique_ptr<Base> v(boxed_str.clone());
+        bench::doNotOptimize(v);
+    });
+
+    // ===================== 访问：256 个混合类型的值 =====================
+    std::vector<AnyValue> any_values;
+    std::vector<std::any> std_values;
+    std::vector<Unique_ptr<Base>> boxed_values;
+    {
+        bench::QuietStdout quiet;
+        for (int i = 0; i < 256; i++) {
+            switch (i % 3) {
+            case 0:
+                any_values.emplace_back(i);
+                std_values.emplace_back(i);
+                boxed_values.emplace_back(new Boxed<int>(i));
+                break;
+            case 1:
+                any_values.emplace_back(i * 0.5);
+                std_values.emplace_back(i * 0.5);
+                boxed_values.emplace_back(new Boxed<double>(i * 0.5));
+                break;
+            default:
+                any_values.emplace_back(kText);
+                std_values.emplace_back(kText);
+                boxed_values.emplace_back(new Boxed<std::string>(kText));
+                break;
+            }
+        }
+    }
+
+    suite.run("visit_x256/AnyValue", kIters / 100, [&any_values] {
+        long long sum = 0;
+        for (AnyValue& v : any_values) {
+            v.visit<int, double, std::string>([&sum](const auto& x) {
+                if constexpr (std::is_same_v<std::decay_t<decltype(x)>, std::string>) {
+                    sum += static_cast<long long>(x.size());
+                } else {
+                    sum += static_cast<long long>(x);
+                }
+            });
+        }
+        bench::doNotOptimize(sum);
+    });
+    suite.run("visit_x256/std::any", kIters / 100, [&std_values] {
+        long long sum = 0;
+        for (const std::any& v : std_values) {
+            if (const int* i = std::any_cast<int>(&v)) {
+                sum += *i;
+            } else if (const double* d = std::any_cast<double>(&v)) {
+                sum += static_cast<long long>(*d);
+            } else if (const std::string* s = std::any_cast<std::string>(&v)) {
+                sum += static_cast<long long>(s->size());
+            }
+        }
+        bench::doNotOptimize(sum);
+    });
+    suite.run("visit_x256/Unique_ptr<Base>", kIters / 100, [&boxed_values] {
+        long long sum = 0;
+        for (const Unique_ptr<Base>& v : boxed_values) {
+            v->accumulate(sum);
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    {
+        bench::QuietStdout quiet;
+        boxed_values.clear();
+    }
+    return suite.finish();
+}
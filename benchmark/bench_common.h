@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+核心定位: 各模块基准程序共用的计时与结果输出工具
+1. Suite::run：预热一次后重复测量 kRepetitions 轮，取每次操作耗时（ns/op）的中位数
+2. 结果同时打印到终端（人读）和写入 JSON 文件（机器读，供 compare.py 对比两次结果）
+   Suite::record 记录计时以外的指标（如每次操作分配的字节数），所有指标都是越小越好
+3. QuietStdout：被测的教学类型在构造/析构里会打印日志，计时期间把 std::cout 置为失败状态，
+   输出语句立即返回，避免把终端 I/O 计入耗时（日志调用本身的少量开销仍然保留）
+用法：bench_xxx [--json=结果文件路径]，默认写到当前目录的 <模块名>.json
+*/
+
+namespace bench {
+
+// 阻止编译器把被测表达式当作无用代码删掉
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void clobberMemory() {
+    asm volatile("" : : : "memory");
+}
+
+// RAII：作用域内屏蔽 std::cout 输出
+class QuietStdout {
+public:
+    QuietStdout() : m_state_(std::cout.rdstate()) {
+        std::cout.setstate(std::ios::badbit);
+    }
+    ~QuietStdout() {
+        std::cout.clear(m_state_);
+    }
+    QuietStdout(const QuietStdout&) = delete;
+    QuietStdout& operator=(const QuietStdout&) = delete;
+
+private:
+    std::ios::iostate m_state_;
+};
+
+// JSON 字符串转义：基准名字里可能出现 '"'、'\\'（如模板参数、路径）
+inline std::string jsonEscape(const std::string& text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+                    out += buf;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    return out;
+}
+
+struct Result {
+    std::string name;        // 形如 "copy/SharedPtr"：对比组/被测类型
+    double value;
+    std::string unit;        // 计时结果为 "ns/op"
+    std::size_t iterations;  // 每轮调用次数
+};
+
+class Suite {
+public:
+    static constexpr int kRepetitions = 5;
+
+    Suite(std::string module, int argc, char* argv[])
+        : m_module_(std::move(module)), m_json_path_(m_module_ + ".json") {
+        const std::string prefix = "--json=";
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            if (arg.compare(0, prefix.size(), prefix) == 0) {
+                m_json_path_ = arg.substr(prefix.size());
+            }
+        }
+        std::cout << "===== 基准模块: " << m_module_ << " =====" << std::endl;
+    }
+
+    // 测量 op() 的单次耗时；op 内部的日志输出会被屏蔽
+    template<typename Op>
+    void run(const std::string& name, std::size_t iterations, Op&& op) {
+        std::vector<double> samples;
+        {
+            QuietStdout quiet;
+            for (std::size_t i = 0; i < iterations / 10 + 1; i++) {  // 预热
+                op();
+            }
+            for (int r = 0; r < kRepetitions; r++) {
+                auto start = std::chrono::steady_clock::now();
+                for (std::size_t i = 0; i < iterations; i++) {
+                    op();
+                }
+                auto ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+                samples.push_back(ns / iterations);
+            }
+        }
+        std::sort(samples.begin(), samples.end());
+        record(name, samples[samples.size() / 2], "ns/op", iterations);
+    }
+
+    // 记录一个已测得的指标
+    void record(const std::string& name, double value, const std::string& unit, std::size_t iterations = 1) {
+        std::cout << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(2)
+                  << std::setw(12) << value << " " << unit << std::endl;
+        m_results_.push_back(Result{name, value, unit, iterations});
+    }
+
+    // 写出 JSON 结果，返回值可直接作为 main 的返回值
+    int finish() const {
+        std::ofstream out(m_json_path_);
+        if (!out) {
+            std::cerr << "无法写入结果文件: " << m_json_path_ << std::endl;
+            return 1;
+        }
+        out << "{\n  \"module\": \"" << jsonEscape(m_module_) << "\",\n  \"results\": [\n";
+        for (std::size_t i = 0; i < m_results_.size(); i++) {
+            const Result& r = m_results_[i];
+            out << "    {\"name\": \"" << jsonEscape(r.name) << "\", \"value\": " << std::setprecision(3) << std::fixed
+                << r.value << ", \"unit\": \"" << jsonEscape(r.unit) << "\", \"iterations\": " << r.iterations << "}"
+                << (i + 1 < m_results_.size() ? "," : "") << "\n";
+        }
+        out << "  ]\n}\n";
+        std::cout << "结果已写入 " << m_json_path_ << std::endl;
+        return 0;
+    }
+
+private:
+    std::string m_module_;
+    std::string m_json_path_;
+    std::vector<Result> m_results_;
+};
+
+} // namespace bench
@@ -0,0 +1,111 @@
+#include <string>
+#include <string_view>
+#include <vector>
+#include "bench_common.h"
+#include "alloc_counter.h"
+#include "../协程/lazy_split.h"
+
+// 惰性切分：协程生成器产出 string_view vs 一次性切分成 std::vector<MyString>
+// 对比吞吐（整块缓冲区的耗时）、峰值内存，以及只需要前几个结果时的提前终止
+static MyString makeLogBuffer(std::size_t lines) {
+    std::string text;
+    for (std::size_t i = 0; i < lines; i++) {
+        text += "2024-01-01T00:00:00 host-" + std::to_string(i % 64);
+        text += (i % 5000 == 4999) ? " ERROR" : " INFO";
+        text += " request_id=" + std::to_string(i) + " latency_ms=" + std::to_string(i % 97) + " path=/api/v1/items\n";
+    }
+    bench::QuietStdout quiet;
+    return MyString(text.data(), text.size());
+}
+
+static std::vector<MyString> eagerTokens(const MyString& buffer) {
+    std::vector<MyString> tokens;
+    std::string_view text = lazy::view(buffer);
+    std::size_t start = text.find_first_not_of(" \n");
+    while (start != std::string_view::npos) {
+        std::size_t end = text.find_first_of(" \n", start);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        tokens.emplace_back(text.data() + start, end - start);
+        start = text.find_first_not_of(" \n", end);
+    }
+    return tokens;
+}
+
+static std::vector<MyString> eagerLines(const MyString& buffer) {
+    std::vector<MyString> result;
+    std::string_view text = lazy::view(buffer);
+    std::size_t start = 0;
+    while (start < text.size()) {
+        std::size_t end = text.find('\n', start);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        result.emplace_back(text.data() + start, end - start);
+        start = end + 1;
+    }
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    bench::Suite suite("lazy_split", argc, argv);
+    const MyString buffer = makeLogBuffer(100000);
+    std::cout << "缓冲区大小: " << buffer.size() / 1024 << " KiB" << std::endl;
+
+    // ===================== 吞吐：切分整个缓冲区 =====================
+    suite.run("tokenize_all/eager_vector<MyString>", 3, [&buffer] {
+        std::vector<MyString> tokens = eagerTokens(buffer);
+        bench::doNotOptimize(tokens.size());
+    });
+    suite.run("tokenize_all/lazy_generator", 3, [&buffer] {
+        std::size_t bytes = 0;
+        for (std::string_view token : lazy::tokenize(buffer, " \n")) {
+            bytes += token.size();
+        }
+        bench::doNotOptimize(bytes);
+    });
+
+    // ===================== 峰值内存（相对开始切分时）=====================
+    {
+        std::size_t peak = 0;
+        {
+            bench::QuietStdout quiet;
+            bench::AllocScope scope;
+            std::vector<MyString> tokens = eagerTokens(buffer);
+            peak = scope.peakBytes();
+        }
+        suite.record("tokenize_peak_memory/eager_vector<MyString>", peak / 1024.0, "KiB");
+    }
+    {
+        bench::AllocScope scope;
+        std::size_t bytes = 0;
+        for (std::string_view token : lazy::tokenize(buffer, " \n")) {
+            bytes += token.size();
+        }
+        bench::doNotOptimize(bytes);
+        suite.record("tokenize_peak_memory/lazy_generator", scope.peakBytes() / 1024.0, "KiB");
+    }
+
+    // ===================== 提前终止：只要前 3 条 ERROR 日志 =====================
+    auto is_error = [](std::string_view line) { return line.find(" ERROR ") != std::string_view::npos; };
+    suite.run("first_3_errors/eager_vector<MyString>", 3, [&buffer, &is_error] {
+        std::vector<MyString> all = eagerLines(buffer);
+        std::size_t found = 0;
+        for (const MyString& line : all) {
+            if (is_error(lazy::view(line)) && ++found == 3) {
+                break;
+            }
+        }
+        bench::doNotOptimize(found);
+    });
+    suite.run("first_3_errors/lazy_generator", 100, [&buffer, &is_error] {
+        std::size_t found = 0;
+        for (std::string_view line : lazy::take(lazy::filter(lazy::lines(buffer), is_error), 3)) {
+            found += line.size() > 0;
+        }
+        bench::doNotOptimize(found);
+    });
+
+    return suite.finish();
+}
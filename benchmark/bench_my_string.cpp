@@ -0,0 +1,72 @@
+#include <string>
+#include <utility>
+#include "bench_common.h"
+#include "alloc_counter.h"
+#include "../构造函数/my_string.h"
+
+// MyString 模块：MyString vs std::string（短字符串可走 std::string 的 SSO，长字符串必须堆分配）
+int main(int argc, char* argv[]) {
+    bench::Suite suite("my_string", argc, argv);
+    const std::size_t kIters = 200000;
+    const char* kShort = "hello";
+    const char* kLong = "a fairly long log line that does not fit into any small string buffer";
+
+    suite.run("construct_short/MyString", kIters, [kShort] {
+        MyString s(kShort);
+        bench::doNotOptimize(s);
+    });
+    suite.run("construct_short/std::string", kIters, [kShort] {
+        std::string s(kShort);
+        bench::doNotOptimize(s);
+    });
+    suite.run("construct_long/MyString", kIters, [kLong] {
+        MyString s(kLong);
+        bench::doNotOptimize(s);
+    });
+    suite.run("construct_long/std::string", kIters, [kLong] {
+        std::string s(kLong);
+        bench::doNotOptimize(s);
+    });
+
+    MyString my_long = [kLong] {
+        bench::QuietStdout quiet;
+        return MyString(kLong);
+    }();
+    std::string std_long(kLong);
+    suite.run("copy_long/MyString", kIters, [&my_long] {
+        MyString copy = my_long;
+        bench::doNotOptimize(copy);
+    });
+    suite.run("copy_long/std::string", kIters, [&std_long] {
+        std::string copy = std_long;
+        bench::doNotOptimize(copy);
+    });
+    suite.run("move_long/MyString", kIters, [kLong] {
+        MyString src(kLong);
+        MyString dst = std::move(src);
+        bench::doNotOptimize(dst);
+    });
+    suite.run("move_long/std::string", kIters, [kLong] {
+        std::string src(kLong);
+        std::string dst = std::move(src);
+        bench::doNotOptimize(dst);
+    });
+
+    // ===================== 泄漏检查：构造 / 拷贝 / 移动后全部析构，剩余未释放字节应为 0 =====================
+    // MyString 早期版本没有析构函数，上面的耗时因此少算了 delete[]；这一项把泄漏纳入回退追踪
+    {
+        const std::size_t live_before = bench::g_alloc_stats.live_bytes.load();
+        {
+            bench::QuietStdout quiet;
+            MyString a(kLong);
+            MyString b = a;
+            MyString c = std::move(b);
+            a = c;
+            bench::doNotOptimize(c);
+        }
+        const std::size_t live_after = bench::g_alloc_stats.live_bytes.load();
+        suite.record("leaked_bytes/MyString", static_cast<double>(live_after - live_before), "bytes");
+    }
+
+    return suite.finish();
+}
@@ -0,0 +1,108 @@
+#include <random>
+#include <vector>
+#include "bench_common.h"
+#include "alloc_counter.h"
+#include "../智能指针/persistent_vector.h"
+
+// 持久化向量：快照成本、内存共享、随机访问，对比每次复制一份 std::vector
+int main(int argc, char* argv[]) {
+    bench::Suite suite("persistent_vector", argc, argv);
+    const std::size_t kSize = 100000;
+
+    // ===================== 构建 =====================
+    suite.run("build_100k/std::vector", 20, [kSize] {
+        std::vector<int> v;
+        for (std::size_t i = 0; i < kSize; i++) {
+            v.push_back(static_cast<int>(i));
+        }
+        bench::doNotOptimize(v.data());
+    });
+    suite.run("build_100k/TransientVector", 20, [kSize] {
+        TransientVector<int> t = PersistentVector<int>().transient();
+        for (std::size_t i = 0; i < kSize; i++) {
+            t.push_back(static_cast<int>(i));
+        }
+        bench::doNotOptimize(t.size());
+    });
+    suite.run("build_100k/PersistentVector", 20, [kSize] {
+        PersistentVector<int> v;
+        for (std::size_t i = 0; i < kSize; i++) {
+            v = v.push_back(static_cast<int>(i));
+        }
+        bench::doNotOptimize(v.size());
+    });
+
+    std::vector<int> vec(kSize);
+    TransientVector<int> builder = PersistentVector<int>().transient();
+    for (std::size_t i = 0; i < kSize; i++) {
+        vec[i] = static_cast<int>(i);
+        builder.push_back(static_cast<int>(i));
+    }
+    const PersistentVector<int> pvec = builder.persistent();
+
+    // ===================== 快照：给读者一份不会再变的副本 =====================
+    suite.run("snapshot_100k/std::vector", 200, [&vec] {
+        std::vector<int> copy = vec;
+        bench::doNotOptimize(copy.data());
+    });
+    suite.run("snapshot_100k/PersistentVector", 200000, [&pvec] {
+        PersistentVector<int> copy = pvec;
+        bench::doNotOptimize(copy.size());
+    });
+
+    // ===================== 修改一个元素并得到新快照 =====================
+    std::size_t k = 0;
+    suite.run("update_snapshot_100k/std::vector", 200, [&vec, &k, kSize] {
+        std::vector<int> next = vec;
+        next[k++ % kSize] = -1;
+        bench::doNotOptimize(next.data());
+    });
+    suite.run("update_snapshot_100k/PersistentVector", 200000, [&pvec, &k, kSize] {
+        PersistentVector<int> next = pvec.set(k++ % kSize, -1);
+        bench::doNotOptimize(next.size());
+    });
+
+    // ===================== 内存共享：保留 100 个各改了一个元素的版本 =====================
+    {
+        bench::AllocScope scope;
+        std::vector<std::vector<int>> versions;
+        versions.reserve(100);
+        for (std::size_t i = 0; i < 100; i++) {
+            versions.push_back(vec);
+            versions.back()[i * 997 % kSize] = -1;
+        }
+        suite.record("memory_100_versions/std::vector", scope.bytes() / 1024.0, "KiB");
+    }
+    {
+        bench::AllocScope scope;
+        std::vector<PersistentVector<int>> versions;
+        versions.reserve(100);
+        for (std::size_t i = 0; i < 100; i++) {
+            versions.push_back(pvec.set(i * 997 % kSize, -1));
+        }
+        suite.record("memory_100_versions/PersistentVector", scope.bytes() / 1024.0, "KiB");
+    }
+
+    // ===================== 随机访问 =====================
+    std::vector<std::size_t> indices(1024);
+    std::mt19937 rng(42);
+    for (auto& i : indices) {
+        i = rng() % kSize;
+    }
+    suite.run("random_read_x1024/std::vector", 2000, [&vec, &indices] {
+        long long sum = 0;
+        for (std::size_t i : indices) {
+            sum += vec[i];
+        }
+        bench::doNotOptimize(sum);
+    });
+    suite.run("random_read_x1024/PersistentVector", 2000, [&pvec, &indices] {
+        long long sum = 0;
+        for (std::size_t i : indices) {
+            sum += pvec[i];
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    return suite.finish();
+}
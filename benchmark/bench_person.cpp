@@ -0,0 +1,38 @@
+#include <memory>
+#include <vector>
+#include "bench_common.h"
+#include "../new_delete/person.h"
+
+// Person 模块：new / new[] 手动管理 vs std::make_unique / std::vector
+int main(int argc, char* argv[]) {
+    bench::Suite suite("person", argc, argv);
+    const std::size_t kIters = 100000;
+
+    suite.run("single/new_delete", kIters, [] {
+        Person* p = new Person("张三", 20);
+        bench::doNotOptimize(p);
+        delete p;
+    });
+    suite.run("single/std::make_unique", kIters, [] {
+        auto p = std::make_unique<Person>("张三", 20);
+        bench::doNotOptimize(p.get());
+    });
+    suite.run("array5/new[]", kIters, [] {
+        Person* people = new Person[5]{Person("张三", 20), Person("李四", 21), Person("王五", 22),
+                                       Person("赵六", 23), Person("孙七", 24)};
+        bench::doNotOptimize(people);
+        delete[] people;
+    });
+    suite.run("array5/std::vector", kIters, [] {
+        std::vector<Person> people;
+        people.reserve(5);
+        people.emplace_back("张三", 20);
+        people.emplace_back("李四", 21);
+        people.emplace_back("王五", 22);
+        people.emplace_back("赵六", 23);
+        people.emplace_back("孙七", 24);
+        bench::doNotOptimize(people.data());
+    });
+
+    return suite.finish();
+}
@@ -0,0 +1,105 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "bench_common.h"
+#include "alloc_counter.h"
+#include "../new_delete/person_store.h"
+
+// Person 记录文件：mmap + PersonView 零拷贝读取 vs 逐条构造 Person 对象
+// 文件写完后已在页缓存中，这里测的是热缓存下的加载与扫描，不包含磁盘 I/O
+int main(int argc, char* argv[]) {
+    bench::Suite suite("person_store", argc, argv);
+    const std::size_t kCount = 200000;
+    const std::string path = "bench_people.pstore";
+
+    suite.run("write_200k/PersonStoreWriter", 1, [&] {
+        PersonStoreWriter writer(path);
+        for (std::size_t i = 0; i < kCount; i++) {
+            // 名字长度超过 std::string 的短字符串缓冲区，与真实数据一致
+            writer.add("person_" + std::to_string(i) + "@example.com", static_cast<int>(i % 100));
+        }
+        writer.finish();
+    });
+
+    // ===================== 加载 =====================
+    suite.run("load_200k/PersonStoreReader", 1000, [&] {
+        PersonStoreReader reader(path);
+        bench::doNotOptimize(reader.size());
+    });
+    suite.run("load_200k/vector<Person>", 3, [&] {
+        PersonStoreReader reader(path);
+        std::vector<Person> people;
+        people.reserve(reader.size());
+        reader.scan([&people](const PersonView& p) {
+            people.emplace_back(std::string(p.name), p.age);
+        });
+        bench::doNotOptimize(people.data());
+    });
+
+    {
+        bench::AllocScope scope;
+        PersonStoreReader reader(path);
+        suite.record("load_allocations/PersonStoreReader", scope.allocations(), "allocs");
+    }
+    {
+        std::size_t allocations = 0;
+        {
+            bench::QuietStdout quiet;
+            bench::AllocScope scope;
+            PersonStoreReader reader(path);
+            std::vector<Person> people;
+            people.reserve(reader.size());
+            reader.scan([&people](const PersonView& p) {
+                people.emplace_back(std::string(p.name), p.age);
+            });
+            allocations = scope.allocations();
+        }
+        suite.record("load_allocations/vector<Person>", allocations, "allocs");
+    }
+
+    // ===================== 顺序扫描：统计年龄和与名字总长度 =====================
+    PersonStoreReader reader(path);
+    std::vector<Person> people;
+    {
+        bench::QuietStdout quiet;
+        people.reserve(reader.size());
+        reader.scan([&people](const PersonView& p) {
+            people.emplace_back(std::string(p.name), p.age);
+        });
+    }
+    suite.run("scan_200k/PersonView", 20, [&reader] {
+        long long sum = 0;
+        reader.scan([&sum](const PersonView& p) {
+            sum += p.age + static_cast<long long>(p.name.size());
+        });
+        bench::doNotOptimize(sum);
+    });
+    suite.run("scan_200k/vector<Person>", 20, [&people] {
+        long long sum = 0;
+        for (const Person& p : people) {
+            sum += p.age() + static_cast<long long>(p.name().size());
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    // ===================== 随机访问：按文件偏移 =====================
+    std::vector<std::uint64_t> offsets;
+    for (std::size_t i = 0; i < 1024; i++) {
+        offsets.push_back(reader.offsetOf(i * 7919 % kCount));
+    }
+    reader.adviseRandom();
+    suite.run("random_x1024/atOffset", 2000, [&reader, &offsets] {
+        long long sum = 0;
+        for (std::uint64_t off : offsets) {
+            sum += reader.atOffset(off).age;
+        }
+        bench::doNotOptimize(sum);
+    });
+
+    {
+        bench::QuietStdout quiet;
+        people.clear();
+    }
+    std::remove(path.c_str());
+    return suite.finish();
+}
@@ -0,0 +1,49 @@
+#include <utility>
+#include "bench_common.h"
+#include "../运算符重载/point.h"
+
+// Point 模块：运算符重载 vs 直接操作 std::pair<int, int>
+static std::pair<int, int> addPair(const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return {a.first + b.first, a.second + b.second};
+}
+
+int main(int argc, char* argv[]) {
+    bench::Suite suite("point", argc, argv);
+    const std::size_t kIters = 1000000;
+
+    Point p(1, 2);
+    Point q(3, 4);
+    std::pair<int, int> pp(1, 2);
+    std::pair<int, int> pq(3, 4);
+
+    suite.run("add/Point", kIters, [&] {
+        Point r = p + q;
+        bench::doNotOptimize(r);
+    });
+    suite.run("add/std::pair", kIters, [&] {
+        std::pair<int, int> r = addPair(pp, pq);
+        bench::doNotOptimize(r);
+    });
+    suite.run("add_scalar/Point", kIters, [&] {
+        Point r = p + 5;
+        bench::doNotOptimize(r);
+    });
+    suite.run("add_scalar/std::pair", kIters, [&] {
+        std::pair<int, int> r(pp.first + 5, pp.second + 5);
+        bench::doNotOptimize(r);
+    });
+    suite.run("pre_increment/Point", kIters, [&] {
+        bench::doNotOptimize(++p);
+    });
+    suite.run("post_increment/Point", kIters, [&] {
+        Point old = p++;
+        bench::doNotOptimize(old);
+    });
+    suite.run("increment/std::pair", kIters, [&] {
+        ++pp.first;
+        ++pp.second;
+        bench::doNotOptimize(pp);
+    });
+
+    return suite.finish();
+}
@@ -0,0 +1,91 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "../模板类/ring_buffer.h"
+#include "../模板类/mutex_queue.h"
+
+// 环形缓冲区：SPSC / MPMC vs "std::mutex + std::queue"，测量 P 个生产者、C 个消费者搬运 200k 个元素的总耗时
+// 单元素版本用 try_push / try_pop，批量版本用 push_n / pop_n（每批 32 个）
+
+// 搬运 items_per_producer * producers 个元素；batch 为 0 时逐个 push/pop，否则批量 push_n/pop_n
+template<typename Queue>
+void transfer(Queue& queue, int producers, int consumers, std::size_t items_per_producer, std::size_t batch) {
+    const std::size_t total = items_per_producer * producers;
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&] {
+            if (batch == 0) {
+                for (std::size_t i = 0; i < items_per_producer; i++) {
+                    std::int64_t value = static_cast<std::int64_t>(i);
+                    while (!queue.try_push(std::move(value))) {
+                        std::this_thread::yield();
+                    }
+                }
+                return;
+            }
+            std::vector<std::int64_t> values(batch);
+            for (std::size_t sent = 0; sent < items_per_producer;) {
+                const std::size_t n = std::min(batch, items_per_producer - sent);
+                for (std::size_t done = 0; done < n;) {
+                    const std::size_t pushed = queue.push_n(values.begin() + done, n - done);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                    done += pushed;
+                }
+                sent += n;
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            std::vector<std::int64_t> values(batch == 0 ? 1 : batch);
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                const std::size_t popped =
+                    batch == 0 ? (queue.try_pop(values[0]) ? 1 : 0) : queue.pop_n(values.begin(), batch);
+                if (popped == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                bench::doNotOptimize(values[0]);
+                consumed.fetch_add(popped, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bench::Suite suite("ring_buffer", argc, argv);
+    const std::size_t kCapacity = 1024;
+    const std::size_t kItems = 200000;
+    const std::size_t kBatch = 32;
+
+    for (std::size_t batch : {std::size_t{0}, kBatch}) {
+        const std::string suffix = batch == 0 ? "" : "_batch32";
+        suite.run("transfer_200k_P1C1" + suffix + "/SpscRingBuffer", 1, [&] {
+            SpscRingBuffer<std::int64_t> queue(kCapacity);
+            transfer(queue, 1, 1, kItems, batch);
+        });
+        const int configs[][2] = {{1, 1}, {2, 2}, {4, 4}};
+        for (const auto& cfg : configs) {
+            const std::string shape =
+                "transfer_200k_P" + std::to_string(cfg[0]) + "C" + std::to_string(cfg[1]) + suffix;
+            suite.run(shape + "/MpmcRingBuffer", 1, [&] {
+                MpmcRingBuffer<std::int64_t> queue(kCapacity);
+                transfer(queue, cfg[0], cfg[1], kItems / cfg[0], batch);
+            });
+            suite.run(shape + "/mutex+queue", 1, [&] {
+                MutexQueue<std::int64_t> queue(kCapacity);
+                transfer(queue, cfg[0], cfg[1], kItems / cfg[0], batch);
+            });
+        }
+    }
+
+    return suite.finish();
+}
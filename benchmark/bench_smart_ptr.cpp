@@ -0,0 +1,68 @@
+#include <memory>
+#include <utility>
+#include "bench_common.h"
+#include "../智能指针/shared_ptr_design.h"
+#include "../智能指针/unique_ptr_design.h"
+
+// 智能指针模块：SharedPtr vs std::shared_ptr，Unique_ptr vs std::unique_ptr
+int main(int argc, char* argv[]) {
+    bench::Suite suite("smart_ptr", argc, argv);
+    const std::size_t kIters = 200000;
+
+    // ===================== SharedPtr =====================
+    suite.run("create/SharedPtr", kIters, [] {
+        SharedPtr<int> p(new int(1));
+        bench::doNotOptimize(*p);
+    });
+    suite.run("create/std::shared_ptr", kIters, [] {
+        std::shared_ptr<int> p(new int(1));
+        bench::doNotOptimize(*p);
+    });
+    suite.run("create/std::make_shared", kIters, [] {
+        auto p = std::make_shared<int>(1);
+        bench::doNotOptimize(*p);
+    });
+
+    // 构造被测对象时同样屏蔽日志
+    SharedPtr<int> shared = [] {
+        bench::QuietStdout quiet;
+        return SharedPtr<int>(new int(42));
+    }();
+    std::shared_ptr<int> std_shared = std::make_shared<int>(42);
+    suite.run("copy/SharedPtr", kIters, [&shared] {
+        SharedPtr<int> copy = shared;
+        bench::doNotOptimize(copy.use_count());
+    });
+    suite.run("copy/std::shared_ptr", kIters, [&std_shared] {
+        std::shared_ptr<int> copy = std_shared;
+        bench::doNotOptimize(copy.use_count());
+    });
+    suite.run("deref/SharedPtr", kIters, [&shared] {
+        bench::doNotOptimize(*shared);
+    });
+    suite.run("deref/std::shared_ptr", kIters, [&std_shared] {
+        bench::doNotOptimize(*std_shared);
+    });
+
+    // ===================== Unique_ptr =====================
+    suite.run("create/Unique_ptr", kIters, [] {
+        Unique_ptr<int> p(new int(1));
+        bench::doNotOptimize(*p);
+    });
+    suite.run("create/std::unique_ptr", kIters, [] {
+        std::unique_ptr<int> p(new int(1));
+        bench::doNotOptimize(*p);
+    });
+    suite.run("move/Unique_ptr", kIters, [] {
+        Unique_ptr<int> a(new int(1));
+        Unique_ptr<int> b = std::move(a);
+        bench::doNotOptimize(*b);
+    });
+    suite.run("move/std::unique_ptr", kIters, [] {
+        std::unique_ptr<int> a(new int(1));
+        std::unique_ptr<int> b = std::move(a);
+        bench::doNotOptimize(*b);
+    });
+
+    return suite.finish();
+}
@@ -0,0 +1,121 @@
+#include <random>
+#include <vector>
+#include "bench_common.h"
+#include "alloc_counter.h"
+#include "../空间索引/spatial_index.h"
+
+// 空间索引：k-d 树 / 均匀网格 vs 暴力扫描，对比 构建耗时、单次查询延迟、批量查询、索引内存
+// 点均匀分布在 100000 × 100000 的正方形内；每个计时条目轮流使用一组固定的随机查询点
+int main(int argc, char* argv[]) {
+    bench::Suite suite("spatial_index", argc, argv);
+    const std::size_t kCount = 200000;
+    const std::size_t kQueries = 1024;
+    const std::size_t kNeighbors = 8;
+    const std::int64_t kRadius = 1000;   // 平均约 60 个点
+    const int kHalfBox = 1000;           // 2000 × 2000 的矩形，平均约 80 个点
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coord(0, 99999);
+    std::vector<Point> points;
+    points.reserve(kCount);
+    for (std::size_t i = 0; i < kCount; i++) {
+        points.emplace_back(coord(rng), coord(rng));
+    }
+    std::vector<Point> queries;
+    for (std::size_t i = 0; i < kQueries; i++) {
+        queries.emplace_back(coord(rng), coord(rng));
+    }
+
+    WorkStealingPool pool;
+
+    // ===================== 构建 =====================
+    suite.run("build_200k/KdTree", 10, [&points] {
+        KdTree tree(points);
+        bench::doNotOptimize(tree);
+    });
+    suite.run("build_200k/KdTree+pool", 10, [&points, &pool] {
+        KdTree tree(points, &pool);
+        bench::doNotOptimize(tree);
+    });
+    suite.run("build_200k/UniformGrid", 10, [&points] {
+        UniformGrid grid(points);
+        bench::doNotOptimize(grid);
+    });
+    suite.run("build_200k/UniformGrid+pool", 10, [&points, &pool] {
+        UniformGrid grid(points, 0, &pool);
+        bench::doNotOptimize(grid);
+    });
+
+    // ===================== 内存：索引常驻大小 + 构建期间峰值 =====================
+    {
+        bench::AllocScope scope;
+        KdTree tree(points);
+        suite.record("memory_index/KdTree", tree.memoryBytes() / 1024.0, "KiB");
+        suite.record("memory_build_peak/KdTree", scope.peakBytes() / 1024.0, "KiB");
+    }
+    {
+        bench::AllocScope scope;
+        UniformGrid grid(points);
+        suite.record("memory_index/UniformGrid", grid.memoryBytes() / 1024.0, "KiB");
+        suite.record("memory_build_peak/UniformGrid", scope.peakBytes() / 1024.0, "KiB");
+    }
+
+    KdTree tree(points);
+    UniformGrid grid(points);
+    std::size_t next = 0;
+    auto nextQuery = [&queries, &next]() -> const Point& {
+        next = (next + 1) % queries.size();
+        return queries[next];
+    };
+
+    // ===================== 单次查询延迟 =====================
+    suite.run("knn8/brute_force", 200, [&] {
+        bench::doNotOptimize(bruteForceKnn(points, nextQuery(), kNeighbors));
+    });
+    suite.run("knn8/KdTree", 20000, [&] {
+        bench::doNotOptimize(tree.knn(nextQuery(), kNeighbors));
+    });
+    suite.run("knn8/UniformGrid", 20000, [&] {
+        bench::doNotOptimize(grid.knn(nextQuery(), kNeighbors));
+    });
+
+    suite.run("radius1000/brute_force", 200, [&] {
+        bench::doNotOptimize(bruteForceRadius(points, nextQuery(), kRadius));
+    });
+    suite.run("radius1000/KdTree", 20000, [&] {
+        bench::doNotOptimize(tree.radius(nextQuery(), kRadius));
+    });
+    suite.run("radius1000/UniformGrid", 20000, [&] {
+        bench::doNotOptimize(grid.radius(nextQuery(), kRadius));
+    });
+
+    auto boxQuery = [&](auto&& query) {
+        const Point& q = nextQuery();
+        return query(Point(q.x() - kHalfBox, q.y() - kHalfBox), Point(q.x() + kHalfBox, q.y() + kHalfBox));
+    };
+    suite.run("box2000/brute_force", 200, [&] {
+        bench::doNotOptimize(boxQuery([&](const Point& lo, const Point& hi) { return bruteForceBox(points, lo, hi); }));
+    });
+    suite.run("box2000/KdTree", 20000, [&] {
+        bench::doNotOptimize(boxQuery([&](const Point& lo, const Point& hi) { return tree.box(lo, hi); }));
+    });
+    suite.run("box2000/UniformGrid", 20000, [&] {
+        bench::doNotOptimize(boxQuery([&](const Point& lo, const Point& hi) { return grid.box(lo, hi); }));
+    });
+
+    // ===================== 批量查询：1024 个 kNN，串行 vs 线程池 =====================
+    suite.run("knn8_batch_1024/KdTree", 20, [&] {
+        bench::doNotOptimize(tree.knnBatch(queries, kNeighbors));
+    });
+    suite.run("knn8_batch_1024/KdTree+pool", 20, [&] {
+        bench::doNotOptimize(tree.knnBatch(queries, kNeighbors, &pool));
+    });
+    suite.run("knn8_batch_1024/UniformGrid", 20, [&] {
+        bench::doNotOptimize(grid.knnBatch(queries, kNeighbors));
+    });
+    suite.run("knn8_batch_1024/UniformGrid+pool", 20, [&] {
+        bench::doNotOptimize(grid.knnBatch(queries, kNeighbors, &pool));
+    });
+
+    return suite.finish();
+}
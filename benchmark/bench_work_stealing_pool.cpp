@@ -0,0 +1,51 @@
+#include <atomic>
+#include <string>
+#include <vector>
+#include "bench_common.h"
+#include "../线程池/work_stealing_pool.h"
+#include "../线程池/synthetic_load.h"
+
+// 工作窃取线程池：parallel_for 在均匀 / 倾斜负载下随线程数的耗时，以及 TaskGroup 提交小任务的开销
+// 各线程数的结果与 "serial" 条目对比即为加速比；单核机器上各条目接近，只用于追踪回退
+
+using synthetic_load::burn;
+using synthetic_load::makeCosts;
+
+int main(int argc, char* argv[]) {
+    bench::Suite suite("work_stealing_pool", argc, argv);
+    const std::size_t kElements = 20000;
+
+    for (bool skewed : {false, true}) {
+        const std::string load = skewed ? "parallel_for_skewed_20k" : "parallel_for_uniform_20k";
+        const std::vector<std::size_t> costs = makeCosts(kElements, skewed);
+        std::vector<double> out(kElements);
+
+        suite.run(load + "/serial", 5, [&] {
+            for (std::size_t i = 0; i < kElements; i++) {
+                out[i] = burn(costs[i]);
+            }
+            bench::doNotOptimize(out.data());
+        });
+        for (std::size_t threads : {1, 2, 4, 8}) {
+            WorkStealingPool pool(threads);
+            suite.run(load + "/threads=" + std::to_string(threads), 5, [&] {
+                parallel_for(pool, 0, kElements, [&](std::size_t i) { out[i] = burn(costs[i]); });
+                bench::doNotOptimize(out.data());
+            });
+        }
+    }
+
+    // ===================== 调度开销：10k 个空任务 =====================
+    WorkStealingPool pool;
+    suite.run("task_group_10k_empty/run+wait", 20, [&pool] {
+        std::atomic<int> counter{0};
+        TaskGroup group(pool);
+        for (int i = 0; i < 10000; i++) {
+            group.run([&counter] { counter.fetch_add(1, std::memory_order_relaxed); });
+        }
+        group.wait();
+        bench::doNotOptimize(counter.load());
+    });
+
+    return suite.finish();
+}
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""对比两次基准结果，标记性能回退。
+
+用法:
+    python3 compare.py <基线> <新结果> [--threshold 0.10] [--allow-missing]
+
+<基线>/<新结果> 可以是单个 JSON 文件，也可以是包含多个 *.json 的目录
+（bench_xxx 程序输出的格式）。所有指标都是越小越好，新结果比基线大
+超过 threshold（默认 10%）的条目记为 REGRESSION，存在回退时退出码为 1，方便接入 CI。
+基线为 0 的指标（如分配次数、泄漏字节数）只要变为非 0 就记为 REGRESSION。
+基线中有、新结果中没有的条目记为 MISSING，同样导致退出码为 1（基准崩溃或被改名时
+不会被悄悄放过）；确实删除了条目时加 --allow-missing。新结果中新增的条目只打印不计。
+兼容旧格式：早期结果文件每条只有 ns_per_op 字段，没有 value/unit。
+"""
+
+import argparse
+import json
+import os
+import sys
+
+
+def load(path):
+    files = []
+    if os.path.isdir(path):
+        files = sorted(os.path.join(path, f) for f in os.listdir(path) if f.endswith(".json"))
+    else:
+        files = [path]
+    results = {}
+    for f in files:
+        with open(f, encoding="utf-8") as fp:
+            data = json.load(fp)
+        for r in data.get("results", []):
+            value = r.get("value", r.get("ns_per_op"))
+            if value is None:
+                raise KeyError(f"{f}: 条目 {r.get('name')} 缺少 value / ns_per_op 字段")
+            results[(data["module"], r["name"])] = value
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description="对比两次基准结果")
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10, help="允许的相对变慢比例")
+    parser.add_argument("--allow-missing", action="store_true", help="基线中的条目在新结果中缺失时不视为失败")
+    args = parser.parse_args()
+
+    old = load(args.baseline)
+    new = load(args.current)
+    regressions = 0
+    missing = 0
+    print(f"{'模块/基准':<50}{'基线':>12}{'新结果':>12}{'变化':>10}")
+    for key in sorted(set(old) | set(new)):
+        name = f"{key[0]}/{key[1]}"
+        if key not in old or key not in new:
+            status = "仅基线" if key in old else "新增"
+            flag = ""
+            if key in old and not args.allow_missing:
+                flag = "  MISSING"
+                missing += 1
+            print(f"{name:<50}{old.get(key, float('nan')):>12.2f}{new.get(key, float('nan')):>12.2f}{status:>10}{flag}")
+            continue
+        if old[key] > 0:
+            change = (new[key] - old[key]) / old[key]
+        else:
+            # 基线为 0 时相对变化无意义：0 -> 非 0 一律视为回退
+            change = float("inf") if new[key] > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            flag = "  improved"
+        print(f"{name:<50}{old[key]:>12.2f}{new[key]:>12.2f}{change:>+10.1%}{flag}")
+
+    if regressions or missing:
+        if regressions:
+            print(f"\n发现 {regressions} 项性能回退（阈值 {args.threshold:.0%}）")
+        if missing:
+            print(f"\n新结果缺少 {missing} 项基线条目（确认已删除时加 --allow-missing）")
+        return 1
+    print("\n未发现性能回退")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <string>
+#include "person.h"
 
 // 分配 + 构造
 // 类名* 指针 = new 类名(构造参数); 
@@ -11,25 +12,6 @@
 // 调用每个元素的析构 + 释放数组内存
 // delete[] 指针; 
 
-class Person {
-public:
-    Person(const std::string& name, int age) :name_(name), age_(age) {
-        std::cout << "构造函数调用" << std::endl;
-    }
-
-    ~Person() {
-        std::cout << "析构函数调用" << std::endl;
-    }
-
-    void print() const {
-        std::cout << "name: " << name_ << " age: " << age_ << std::endl;
-    }
-
-private:
-    std::string name_;
-    int age_;
-};
-
 int main(int argc, char* argv[]) {
     // 1. 基础类型动态分配（无构造/析构，但仍需delete）
     int* num = new int(10); // 分配int内存，初始化为10
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+class Person {
+public:
+    Person(const std::string& name, int age) :name_(name), age_(age) {
+        std::cout << "构造函数调用" << std::endl;
+    }
+
+    ~Person() {
+        std::cout << "析构函数调用" << std::endl;
+    }
+
+    const std::string& name() const { return name_; }
+    int age() const { return age_; }
+
+    void print() const {
+        std::cout << "name: " << name_ << " age: " << age_ << std::endl;
+    }
+
+private:
+    std::string name_;
+    int age_;
+};
@@ -0,0 +1,230 @@
+#include "person_store.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using person_store::FileHeader;
+using person_store::Record;
+
+namespace {
+
+std::runtime_error systemError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+}
+
+} // namespace
+
+// ===================== PersonStoreWriter =====================
+PersonStoreWriter::PersonStoreWriter(const std::string& path)
+    : m_path_(path), m_heap_path_(path + ".heap") {
+    m_out_.open(m_path_, std::ios::binary | std::ios::trunc);
+    m_heap_.open(m_heap_path_, std::ios::binary | std::ios::trunc);
+    if (!m_out_ || !m_heap_) {
+        throw std::runtime_error("无法创建文件 " + m_path_);
+    }
+    // 先占住文件头的位置，finish() 时回填
+    FileHeader placeholder{};
+    m_out_.write(reinterpret_cast<const char*>(&placeholder), sizeof(placeholder));
+}
+
+PersonStoreWriter::~PersonStoreWriter() {
+    if (m_finished_) {
+        return;
+    }
+    // 未调用 finish()：不补写文件头。占位的文件头全为 0，读取时魔数校验失败，不会被当成完整文件
+    // 异常展开途中析构：写入过程被打断，半成品文件没有保留价值，直接删除
+    discard(std::uncaught_exceptions() > m_uncaught_on_create_);
+}
+
+void PersonStoreWriter::discard(bool remove_output) {
+    m_finished_ = true;
+    m_out_.close();
+    m_heap_.close();
+    std::remove(m_heap_path_.c_str());
+    if (remove_output) {
+        std::remove(m_path_.c_str());
+    }
+}
+
+void PersonStoreWriter::add(std::string_view name, int age) {
+    if (m_finished_) {
+        throw std::logic_error("PersonStoreWriter::add 在 finish() 之后调用");
+    }
+    // 记录中的长度字段只有 32 位：超长的 name 截断后文件依然能通过 verify()，必须在这里拒绝
+    if (name.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("PersonStoreWriter::add: name 长度超过 4 GiB - 1");
+    }
+    Record record{m_heap_size_, static_cast<std::uint32_t>(name.size()), age};
+    m_out_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    m_heap_.write(name.data(), static_cast<std::streamsize>(name.size()));
+    m_heap_size_ += name.size();
+    ++m_count_;
+}
+
+void PersonStoreWriter::finish() {
+    if (m_finished_) {
+        return;
+    }
+    try {
+        writeTrailer();
+    } catch (...) {
+        // 拼接或回填失败：删除旁路文件和不完整的输出文件后再抛出，之后不能再 add / finish
+        discard(true);
+        throw;
+    }
+    m_finished_ = true;
+}
+
+void PersonStoreWriter::writeTrailer() {
+    // 把旁路的字符串堆拼接到记录之后
+    m_heap_.close();
+    if (!m_heap_) {
+        throw std::runtime_error("写入字符串堆失败 " + m_heap_path_);
+    }
+    std::ifstream heap_in(m_heap_path_, std::ios::binary);
+    if (m_heap_size_ > 0) {
+        m_out_ << heap_in.rdbuf();
+    }
+    heap_in.close();
+    std::remove(m_heap_path_.c_str());
+
+    FileHeader header{};
+    std::memcpy(header.magic, person_store::kMagic, sizeof(header.magic));
+    header.version = person_store::kVersion;
+    header.record_size = sizeof(Record);
+    header.record_count = m_count_;
+    header.records_offset = sizeof(FileHeader);
+    header.heap_offset = sizeof(FileHeader) + m_count_ * sizeof(Record);
+    header.heap_size = m_heap_size_;
+    m_out_.seekp(0);
+    m_out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_out_.close();
+    if (!m_out_) {
+        throw std::runtime_error("写入文件失败 " + m_path_);
+    }
+}
+
+// ===================== PersonStoreReader =====================
+PersonStoreReader::PersonStoreReader(const std::string& path) {
+    m_fd_ = ::open(path.c_str(), O_RDONLY);
+    if (m_fd_ < 0) {
+        throw systemError("无法打开文件", path);
+    }
+    struct stat st;
+    if (::fstat(m_fd_, &st) != 0) {
+        std::runtime_error error = systemError("无法获取文件大小", path);
+        release();
+        throw error;
+    }
+    m_length_ = static_cast<std::size_t>(st.st_size);
+    if (m_length_ < sizeof(FileHeader)) {
+        release();
+        throw std::runtime_error("文件过小，不是 PersonStore 文件: " + path);
+    }
+    m_base_ = ::mmap(nullptr, m_length_, PROT_READ, MAP_SHARED, m_fd_, 0);
+    if (m_base_ == MAP_FAILED) {
+        m_base_ = nullptr;
+        std::runtime_error error = systemError("mmap 失败", path);
+        release();
+        throw error;
+    }
+
+    // 校验文件头：各段必须完整落在文件内
+    const char* base = static_cast<const char*>(m_base_);
+    m_header_ = reinterpret_cast<const FileHeader*>(base);
+    const FileHeader& h = *m_header_;
+    bool ok = std::memcmp(h.magic, person_store::kMagic, sizeof(h.magic)) == 0 &&
+              h.version == person_store::kVersion &&
+              h.record_size == sizeof(Record) &&
+              h.records_offset == sizeof(FileHeader) &&
+              h.record_count <= (m_length_ - sizeof(FileHeader)) / sizeof(Record) &&
+              h.heap_offset == h.records_offset + h.record_count * sizeof(Record) &&
+              h.heap_size <= m_length_ - h.heap_offset;
+    if (!ok) {
+        release();
+        throw std::runtime_error("文件头校验失败，不是有效的 PersonStore 文件: " + path);
+    }
+    m_records_ = reinterpret_cast<const Record*>(base + h.records_offset);
+    m_heap_ = base + h.heap_offset;
+}
+
+PersonStoreReader::~PersonStoreReader() {
+    release();
+}
+
+PersonStoreReader::PersonStoreReader(PersonStoreReader&& other) noexcept {
+    *this = std::move(other);
+}
+
+PersonStoreReader& PersonStoreReader::operator=(PersonStoreReader&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_fd_ = std::exchange(other.m_fd_, -1);
+        m_base_ = std::exchange(other.m_base_, nullptr);
+        m_length_ = std::exchange(other.m_length_, 0);
+        m_header_ = std::exchange(other.m_header_, nullptr);
+        m_records_ = std::exchange(other.m_records_, nullptr);
+        m_heap_ = std::exchange(other.m_heap_, nullptr);
+    }
+    return *this;
+}
+
+void PersonStoreReader::release() {
+    if (m_base_) {
+        ::munmap(m_base_, m_length_);
+        m_base_ = nullptr;
+    }
+    if (m_fd_ >= 0) {
+        ::close(m_fd_);
+        m_fd_ = -1;
+    }
+    m_header_ = nullptr;
+    m_records_ = nullptr;
+    m_heap_ = nullptr;
+}
+
+PersonView PersonStoreReader::at(std::size_t i) const {
+    if (i >= size()) {
+        throw std::out_of_range("PersonStoreReader::at");
+    }
+    const Record& r = m_records_[i];
+    if (r.name_offset > m_header_->heap_size || r.name_length > m_header_->heap_size - r.name_offset) {
+        throw std::out_of_range("PersonStoreReader::at: name 超出字符串堆");
+    }
+    return view(r);
+}
+
+PersonView PersonStoreReader::atOffset(std::uint64_t offset) const {
+    const std::uint64_t begin = m_header_->records_offset;
+    if (offset < begin || (offset - begin) % sizeof(Record) != 0) {
+        throw std::out_of_range("PersonStoreReader::atOffset: 不是记录起点");
+    }
+    return at(static_cast<std::size_t>((offset - begin) / sizeof(Record)));
+}
+
+void PersonStoreReader::verify() const {
+    for (std::size_t i = 0; i < size(); i++) {
+        at(i);
+    }
+}
+
+void PersonStoreReader::adviseSequential() const {
+    ::madvise(m_base_, m_length_, MADV_SEQUENTIAL);
+}
+
+void PersonStoreReader::adviseRandom() const {
+    ::madvise(m_base_, m_length_, MADV_RANDOM);
+}
+
+void PersonStoreReader::adviseWillNeed() const {
+    ::madvise(m_base_, m_length_, MADV_WILLNEED);
+}
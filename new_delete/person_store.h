@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include "person.h"
+
+/*
+核心定位: Person 的定长记录文件格式 + mmap 零拷贝读取
+背景：new Person[n]{...} 每条记录至少一次构造 + 一次 std::string 堆分配，
+      数据量达到百万级时，加载时间主要花在分配和拷贝上
+
+文件布局（小端，所有偏移量都是从文件开头算起的字节数）：
+  [Header   64 字节]  魔数、版本、记录数、各段偏移
+  [Records  N × 16 字节]  定长记录：name 在字符串堆中的偏移 + 长度 + age
+  [String heap]  所有 name 的字节首尾相连（不含 '\0'）
+
+读取时整个文件 mmap 到内存，PersonView 直接指向映射区：
+  - 打开文件 O(1)，与记录数无关，不做任何逐条分配
+  - 定长记录：第 i 条记录的位置可直接算出，支持按下标 / 按文件偏移随机访问
+  - 顺序扫描前用 madvise(MADV_SEQUENTIAL) 提示内核预读
+*/
+
+// 不拥有数据的只读视图：name 指向 mmap 区域，reader 析构后失效
+struct PersonView {
+    std::string_view name;
+    int age;
+};
+
+namespace person_store {
+
+constexpr char kMagic[8] = {'P', 'S', 'T', 'O', 'R', 'E', '0', '1'};
+constexpr std::uint32_t kVersion = 1;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t record_size;
+    std::uint64_t record_count;
+    std::uint64_t records_offset;
+    std::uint64_t heap_offset;
+    std::uint64_t heap_size;
+    std::uint8_t reserved[16];
+};
+static_assert(sizeof(FileHeader) == 64, "FileHeader 必须是 64 字节");
+
+struct Record {
+    std::uint64_t name_offset;   // 相对字符串堆起点
+    std::uint32_t name_length;
+    std::int32_t age;
+};
+static_assert(sizeof(Record) == 16, "Record 必须是 16 字节");
+
+} // namespace person_store
+
+// ===================== 写入：流式输出，内存占用与记录数无关 =====================
+// 记录直接写入目标文件，name 先写入旁路临时文件 <path>.heap，finish() 时拼接到记录之后
+class PersonStoreWriter {
+public:
+    explicit PersonStoreWriter(const std::string& path);
+    // 不会自动 finish()：未完成的文件保持无效（文件头为空）；异常展开途中析构时直接删除该文件
+    ~PersonStoreWriter();
+
+    PersonStoreWriter(const PersonStoreWriter&) = delete;
+    PersonStoreWriter& operator=(const PersonStoreWriter&) = delete;
+
+    // name 长度超过 UINT32_MAX 时抛出 std::length_error
+    void add(std::string_view name, int age);
+    void add(const Person& person) { add(person.name(), person.age()); }
+
+    // 拼接字符串堆、回填文件头；之后不能再 add
+    // 失败时删除旁路文件和输出文件后抛出 std::runtime_error
+    void finish();
+
+    std::uint64_t count() const { return m_count_; }
+
+private:
+    // 拼接字符串堆并回填文件头，失败时抛出
+    void writeTrailer();
+    // 放弃写入：关闭并删除旁路文件，remove_output 为 true 时同时删除输出文件
+    void discard(bool remove_output);
+
+    std::string m_path_;
+    std::string m_heap_path_;
+    std::ofstream m_out_;
+    std::ofstream m_heap_;
+    std::uint64_t m_count_ = 0;
+    std::uint64_t m_heap_size_ = 0;
+    bool m_finished_ = false;
+    int m_uncaught_on_create_ = std::uncaught_exceptions();
+};
+
+// ===================== 读取：mmap 映射整个文件 =====================
+class PersonStoreReader {
+public:
+    // 打开并校验文件，格式错误时抛出 std::runtime_error
+    explicit PersonStoreReader(const std::string& path);
+    ~PersonStoreReader();
+
+    PersonStoreReader(const PersonStoreReader&) = delete;
+    PersonStoreReader& operator=(const PersonStoreReader&) = delete;
+    PersonStoreReader(PersonStoreReader&& other) noexcept;
+    PersonStoreReader& operator=(PersonStoreReader&& other) noexcept;
+
+    std::size_t size() const { return m_header_ ? static_cast<std::size_t>(m_header_->record_count) : 0; }
+
+    // 按下标访问：不检查越界
+    PersonView operator[](std::size_t i) const { return view(m_records_[i]); }
+    // 按下标访问：越界时抛出 std::out_of_range
+    PersonView at(std::size_t i) const;
+
+    // 按文件偏移访问：外部索引可以只保存 8 字节偏移量，而不是整条记录
+    std::uint64_t offsetOf(std::size_t i) const {
+        return m_header_->records_offset + i * sizeof(person_store::Record);
+    }
+    // 偏移量不是某条记录的起点时抛出 std::out_of_range
+    PersonView atOffset(std::uint64_t offset) const;
+
+    // 打开时只校验文件头（O(1)）；读取不可信文件时调用 verify() 逐条检查 name 是否落在字符串堆内
+    void verify() const;
+
+    // 访问模式提示（madvise），只影响内核的预读/回收策略，不影响结果
+    void adviseSequential() const;
+    void adviseRandom() const;
+    void adviseWillNeed() const;
+
+    // 顺序扫描所有记录：先提示顺序访问，再依次回调 f(PersonView)
+    template<typename F>
+    void scan(F&& f) const {
+        adviseSequential();
+        const std::size_t n = size();
+        for (std::size_t i = 0; i < n; i++) {
+            f(view(m_records_[i]));
+        }
+    }
+
+    // 需要拥有数据的 Person 对象时再物化（会分配内存）
+    Person materialize(std::size_t i) const {
+        PersonView v = at(i);
+        return Person(std::string(v.name), v.age);
+    }
+
+private:
+    PersonView view(const person_store::Record& r) const {
+        return PersonView{std::string_view(m_heap_ + r.name_offset, r.name_length), r.age};
+    }
+
+    void release();
+
+    int m_fd_ = -1;
+    void* m_base_ = nullptr;
+    std::size_t m_length_ = 0;
+    const person_store::FileHeader* m_header_ = nullptr;
+    const person_store::Record* m_records_ = nullptr;
+    const char* m_heap_ = nullptr;
+};
@@ -0,0 +1,49 @@
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include "person_store.h"
+
+/*
+核心定位: 演示 person_store.h：把 Person 写成定长记录文件，再用 mmap 零拷贝读取
+对比 new_delete.cpp 中的 new Person[5]{...}：读取端没有任何逐条 new，也不构造 Person
+*/
+
+int main(int argc, char* argv[]) {
+    const std::string path = "people.pstore";
+
+    std::cout << "===== 1. 流式写入 =====" << std::endl;
+    {
+        PersonStoreWriter writer(path);
+        writer.add("张三", 20);
+        writer.add("李四", 21);
+        writer.add("王五", 22);
+        writer.add("赵六", 23);
+        writer.add("孙七", 24);
+        writer.finish();
+        std::cout << "写入记录数: " << writer.count() << std::endl;
+    }
+
+    std::cout << "\n===== 2. mmap 读取：PersonView 直接指向映射内存 =====" << std::endl;
+    PersonStoreReader reader(path);
+    reader.scan([](const PersonView& p) {
+        std::cout << "name: " << p.name << " age: " << p.age << std::endl;
+    });
+
+    std::cout << "\n===== 3. 按文件偏移随机访问 =====" << std::endl;
+    std::uint64_t offset = reader.offsetOf(3);   // 外部索引只需保存这个偏移量
+    PersonView p = reader.atOffset(offset);
+    std::cout << "offset " << offset << " -> " << p.name << " " << p.age << std::endl;
+
+    std::cout << "\n===== 4. 需要时再物化为 Person 对象 =====" << std::endl;
+    Person owned = reader.materialize(0);
+    owned.print();
+
+    try {
+        reader.at(5);
+    } catch (const std::out_of_range& e) {
+        std::cout << "越界访问: " << e.what() << std::endl;
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
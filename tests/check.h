@@ -0,0 +1,30 @@
+#pragma once
+
+#include <iostream>
+
+/*
+核心定位: 测试程序共用的最小断言工具
+- CHECK 失败时打印位置和表达式并计数，不中断后续检查；Release 构建（NDEBUG）下同样生效，不能用 assert 代替
+- main 返回 checkResult()：有失败时返回 1，ctest 据此判定测试失败
+*/
+
+namespace check_detail {
+inline int g_failures = 0;
+} // namespace check_detail
+
+#define CHECK(cond)                                                                          \
+    do {                                                                                     \
+        if (!(cond)) {                                                                       \
+            std::cerr << __FILE__ << ":" << __LINE__ << " 检查失败: " #cond << std::endl;    \
+            ++check_detail::g_failures;                                                      \
+        }                                                                                    \
+    } while (0)
+
+inline int checkResult() {
+    if (check_detail::g_failures > 0) {
+        std::cerr << check_detail::g_failures << " 项检查失败" << std::endl;
+        return 1;
+    }
+    std::cout << "全部检查通过" << std::endl;
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <cstring>
+#include <utility>
+#include "check.h"
+#include "../构造函数/my_string.h"
+
+// MyString 的拷贝构造 / 拷贝赋值：源对象被移动过（m_data_ 为空）或含有内嵌 '\0' 时的行为
+
+static bool sameBytes(const MyString& s, const char* bytes, size_t len) {
+    return s.size() == len && s.data() != nullptr && std::memcmp(s.data(), bytes, len) == 0 && s.data()[len] == '\0';
+}
+
+int main() {
+    // 1. 从被移动过的对象拷贝：按空字符串处理
+    {
+        MyString src("hello");
+        MyString dst = std::move(src);
+        MyString copy(src);
+        CHECK(sameBytes(copy, "", 0));
+
+        MyString assigned("old value");
+        assigned = src;
+        CHECK(sameBytes(assigned, "", 0));
+        CHECK(sameBytes(dst, "hello", 5));
+    }
+
+    // 2. 内嵌 '\0'：拷贝后长度和全部字节保持不变
+    {
+        const char bytes[] = {'a', '\0', 'b', 'c'};
+        MyString src(bytes, sizeof(bytes));
+        MyString copy(src);
+        CHECK(sameBytes(copy, bytes, sizeof(bytes)));
+
+        MyString assigned("x");
+        assigned = src;
+        CHECK(sameBytes(assigned, bytes, sizeof(bytes)));
+    }
+
+    // 3. 自赋值与移动赋值
+    {
+        MyString s("self");
+        MyString& alias = s;
+        s = alias;
+        CHECK(sameBytes(s, "self", 4));
+
+        MyString target("target");
+        target = std::move(s);
+        CHECK(sameBytes(target, "self", 4));
+        CHECK(s.data() == nullptr && s.size() == 0);
+    }
+
+    return checkResult();
+}
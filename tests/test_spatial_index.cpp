@@ -0,0 +1,107 @@
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <vector>
+#include "check.h"
+#include "../空间索引/spatial_index.h"
+
+// KdTree / UniformGrid 与暴力扫描逐一核对：随机点集（含重复点、查询点在范围外）与 int 极值坐标
+
+static bool sameNeighbors(const std::vector<Neighbor>& a, const std::vector<Neighbor>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); i++) {
+        if (a[i].index != b[i].index || a[i].dist2 != b[i].dist2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static std::vector<std::size_t> sorted(std::vector<std::size_t> v) {
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+// 对一个点集和一组查询，检查两种索引的 knn / radius / box 都与暴力扫描一致
+static void checkAgainstBruteForce(const std::vector<Point>& points, const KdTree& tree, const UniformGrid& grid,
+                                   const std::vector<Point>& queries, std::size_t k, std::int64_t r) {
+    for (const Point& q : queries) {
+        const auto expected = bruteForceKnn(points, q, k);
+        CHECK(sameNeighbors(tree.knn(q, k), expected));
+        CHECK(sameNeighbors(grid.knn(q, k), expected));
+
+        const auto in_radius = sorted(bruteForceRadius(points, q, r));
+        CHECK(sorted(tree.radius(q, r)) == in_radius);
+        CHECK(sorted(grid.radius(q, r)) == in_radius);
+
+        const std::int64_t span = std::min<std::int64_t>(r, std::int64_t{1} << 33);
+        const std::int64_t lo_x = std::max<std::int64_t>(INT_MIN, q.x() - span);
+        const std::int64_t hi_y = std::min<std::int64_t>(INT_MAX, q.y() + span);
+        const Point lo(static_cast<int>(lo_x), q.y());
+        const Point hi(q.x(), static_cast<int>(hi_y));
+        const auto in_box = sorted(bruteForceBox(points, lo, hi));
+        CHECK(sorted(tree.box(lo, hi)) == in_box);
+        CHECK(sorted(grid.box(lo, hi)) == in_box);
+    }
+}
+
+int main() {
+    WorkStealingPool pool(2);
+
+    // 1. 随机点集：小范围（大量重复点）与大范围，构建时使用线程池
+    std::mt19937 rng(2024);
+    for (int spread : {8, 100000}) {
+        std::uniform_int_distribution<int> coord(-spread, spread);
+        std::vector<Point> points;
+        for (int i = 0; i < 40000; i++) {
+            points.emplace_back(coord(rng), coord(rng));
+        }
+        std::vector<Point> queries;
+        for (int i = 0; i < 50; i++) {
+            queries.emplace_back(coord(rng) * 3, coord(rng));   // 部分查询点落在点集范围外
+        }
+        KdTree tree(points, &pool);
+        UniformGrid grid(points, 0, &pool);
+        checkAgainstBruteForce(points, tree, grid, queries, 10, spread / 4);
+    }
+
+    // 2. int 极值坐标：坐标跨度 2^32，距离平方超过 64 位；网格格子数的乘积超过 64 位
+    {
+        const std::vector<Point> points = {Point(INT_MIN, INT_MIN), Point(INT_MAX, INT_MAX), Point(0, 0),
+                                           Point(INT_MIN, INT_MAX), Point(INT_MAX, INT_MIN), Point(1, -1)};
+        const std::vector<Point> queries = {Point(INT_MIN, INT_MIN), Point(INT_MAX, INT_MAX), Point(0, 0),
+                                            Point(INT_MAX, 0), Point(-5, 7)};
+        KdTree tree(points);
+        UniformGrid grid(points, 1);
+        CHECK(grid.cellCount() >= 1 && grid.cellCount() <= points.size() * 4 + 16);
+        for (std::int64_t r : {std::int64_t{0}, std::int64_t{3000000000}, std::int64_t{1} << 40, INT64_MAX}) {
+            checkAgainstBruteForce(points, tree, grid, queries, points.size() + 1, r);
+        }
+
+        // 对角两点的距离平方 2 * (2^32 - 1)^2 超过 UINT64_MAX：排序仍然精确，对外报告的值饱和为 UINT64_MAX
+        const auto farthest = tree.knn(Point(INT_MIN, INT_MIN), points.size()).back();
+        CHECK(farthest.index == 1);
+        CHECK(farthest.dist2 == UINT64_MAX);
+        const auto nearest = grid.knn(Point(INT_MAX, INT_MAX), 2);
+        CHECK(nearest.size() == 2 && nearest[0].index == 1 && nearest[0].dist2 == 0);
+    }
+
+    // 3. 边界情况：空点集、k = 0、负半径
+    {
+        const std::vector<Point> empty;
+        KdTree tree(empty);
+        UniformGrid grid(empty);
+        CHECK(tree.knn(Point(0, 0), 3).empty());
+        CHECK(grid.knn(Point(0, 0), 3).empty());
+        CHECK(grid.radius(Point(0, 0), 10).empty());
+
+        const std::vector<Point> one = {Point(1, 2)};
+        KdTree one_tree(one);
+        CHECK(one_tree.knn(Point(0, 0), 0).empty());
+        CHECK(one_tree.radius(Point(1, 2), -1).empty());
+    }
+
+    return checkResult();
+}
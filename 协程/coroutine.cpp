@@ -0,0 +1,56 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include "lazy_split.h"
+
+/*
+核心定位: C++20 协程（coroutine）—— 可以挂起和恢复的函数
+- co_yield：产出一个值并挂起，调用方取走值后再恢复
+- co_return：结束协程
+- co_await：等待某个操作完成（生成器里不使用）
+应用：惰性切分大缓冲区，按需产出字段，不把所有字段一次性拷贝到堆上
+编译：g++ -std=c++20 coroutine.cpp -o coroutine
+*/
+
+// ===================== 一、最简单的生成器 =====================
+Generator<int> counter(int from, int to) {
+    for (int i = from; i <= to; i++) {
+        std::cout << "  [协程] 产出 " << i << std::endl;
+        co_yield i;   // 挂起，直到调用方请求下一个值
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "===== 1. 协程按需执行 =====" << std::endl;
+    for (int v : counter(1, 3)) {
+        std::cout << "  [调用方] 取到 " << v << std::endl;
+    }
+
+    std::cout << "\n===== 2. 在 MyString 上惰性切分，字段是指向原缓冲区的 string_view =====" << std::endl;
+    MyString log("2024-01-01 INFO start\n2024-01-01 WARN disk 90%\r\n2024-01-02 INFO ok\n2024-01-02 ERROR crash");
+    for (std::string_view line : lazy::lines(log)) {
+        std::cout << "  line: [" << line << "]" << std::endl;
+    }
+
+    std::cout << "\n===== 3. 组合：filter + map + take，取到 1 条就停 =====" << std::endl;
+    auto is_problem = [](std::string_view line) {
+        return line.find("WARN") != std::string_view::npos || line.find("ERROR") != std::string_view::npos;
+    };
+    auto date_of = [](std::string_view line) { return line.substr(0, 10); };
+    for (std::string_view date : lazy::take(lazy::map(lazy::filter(lazy::lines(log), is_problem), date_of), 1)) {
+        std::cout << "  第一条告警日期: " << date << std::endl;
+    }
+
+    std::cout << "\n===== 4. 分隔符切分与分词 =====" << std::endl;
+    for (std::string_view field : lazy::split("a,,b", ',')) {
+        std::cout << "  split: [" << field << "]" << std::endl;
+    }
+    for (std::string_view token : lazy::tokenize("  hello \t coroutine  world ")) {
+        std::cout << "  token: [" << token << "]" << std::endl;
+    }
+
+    // 编译错误：临时 MyString 会在遍历前析构
+    // for (auto f : lazy::split(MyString("a,b"), ',')) {}
+
+    return 0;
+}
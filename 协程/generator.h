@@ -0,0 +1,131 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/*
+核心定位: C++20 协程生成器 Generator<T>
+- 函数体里每次 co_yield 产出一个值后挂起，调用方迭代到下一个元素时才恢复执行（惰性求值）
+- 产出的值不拷贝：promise 只保存被 co_yield 对象的地址，该对象在协程恢复前一直有效
+- 调用方提前停止迭代（break / Generator 析构）时协程帧直接销毁，剩余部分永远不会执行
+- 只能单次遍历（input range），Generator 只能移动不能拷贝
+*/
+
+template<typename T>
+class Generator {
+public:
+    using value_type = std::remove_cv_t<std::remove_reference_t<T>>;
+    using pointer = std::add_pointer_t<std::remove_reference_t<T>>;
+
+    struct promise_type {
+        pointer m_value_ = nullptr;
+        std::exception_ptr m_exception_;
+
+        Generator get_return_object() {
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        // 创建后先挂起：第一次 begin() 时才开始执行函数体
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+
+        // 左值和右值都只记录地址：co_yield 表达式中的临时对象活到协程恢复为止
+        std::suspend_always yield_value(std::remove_reference_t<T>& value) noexcept {
+            m_value_ = std::addressof(value);
+            return {};
+        }
+        std::suspend_always yield_value(std::remove_reference_t<T>&& value) noexcept {
+            m_value_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        // 函数体抛出的异常保存下来，在调用方迭代时重新抛出
+        void unhandled_exception() { m_exception_ = std::current_exception(); }
+
+        // 禁止在生成器里 co_await
+        template<typename U>
+        std::suspend_never await_transform(U&&) = delete;
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    struct sentinel {};
+
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = Generator::value_type;
+        using reference = std::remove_reference_t<T>&;
+        using pointer = Generator::pointer;
+
+        iterator() = default;
+        explicit iterator(handle_type handle) : m_handle_(handle) {}
+
+        reference operator*() const { return *m_handle_.promise().m_value_; }
+        pointer operator->() const { return m_handle_.promise().m_value_; }
+
+        iterator& operator++() {
+            m_handle_.resume();
+            rethrowIfFailed();
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator& it, sentinel) { return !it.m_handle_ || it.m_handle_.done(); }
+
+        void rethrowIfFailed() const {
+            if (m_handle_.done() && m_handle_.promise().m_exception_) {
+                std::rethrow_exception(m_handle_.promise().m_exception_);
+            }
+        }
+
+    private:
+        handle_type m_handle_;
+    };
+
+    Generator() = default;
+    ~Generator() {
+        if (m_handle_) {
+            m_handle_.destroy();
+        }
+    }
+
+    Generator(const Generator&) = delete;
+    Generator& operator=(const Generator&) = delete;
+
+    Generator(Generator&& other) noexcept : m_handle_(std::exchange(other.m_handle_, nullptr)) {}
+    Generator& operator=(Generator&& other) noexcept {
+        if (this != &other) {
+            if (m_handle_) {
+                m_handle_.destroy();
+            }
+            m_handle_ = std::exchange(other.m_handle_, nullptr);
+        }
+        return *this;
+    }
+
+    // 开始（或继续）执行到第一个 co_yield
+    iterator begin() {
+        if (m_handle_) {
+            m_handle_.resume();
+            iterator it(m_handle_);
+            it.rethrowIfFailed();
+            return it;
+        }
+        return iterator();
+    }
+
+    sentinel end() noexcept { return {}; }
+
+private:
+    explicit Generator(handle_type handle) : m_handle_(handle) {}
+
+    handle_type m_handle_;
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "generator.h"
+#include "../构造函数/my_string.h"
+
+/*
+核心定位: 基于 Generator 的惰性切分 / 组合适配器
+- split / tokenize / lines 每次只产出一个 std::string_view，指向原缓冲区，不分配内存
+- filter / map / take 接收一个 Generator 并返回新的 Generator，可以任意嵌套组合
+- take 取够 n 个后直接结束，上游生成器随之销毁，缓冲区剩余部分不会被扫描
+注意：产出的 string_view 指向调用方的缓冲区（MyString / 原始字符数组），
+      遍历期间缓冲区必须保持有效；因此 MyString 的右值重载被禁用
+*/
+
+namespace lazy {
+
+// 按单个分隔符切分，保留空字段："a,,b" -> "a", "", "b"
+inline Generator<std::string_view> split(std::string_view text, char delim) {
+    std::size_t start = 0;
+    for (;;) {
+        const std::size_t pos = text.find(delim, start);
+        if (pos == std::string_view::npos) {
+            co_yield text.substr(start);
+            co_return;
+        }
+        co_yield text.substr(start, pos - start);
+        start = pos + 1;
+    }
+}
+
+// 按分隔符集合切分，跳过空字段："  a  b " -> "a", "b"
+inline Generator<std::string_view> tokenize(std::string_view text, std::string_view delims = " \t\r\n") {
+    std::size_t start = text.find_first_not_of(delims);
+    while (start != std::string_view::npos) {
+        const std::size_t end = text.find_first_of(delims, start);
+        if (end == std::string_view::npos) {
+            co_yield text.substr(start);
+            co_return;
+        }
+        co_yield text.substr(start, end - start);
+        start = text.find_first_not_of(delims, end);
+    }
+}
+
+// 按行迭代：兼容 "\r\n"，末尾没有换行的最后一行同样产出
+inline Generator<std::string_view> lines(std::string_view text) {
+    std::size_t start = 0;
+    while (start < text.size()) {
+        std::size_t end = text.find('\n', start);
+        const std::size_t next = (end == std::string_view::npos) ? text.size() : end + 1;
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        if (end > start && text[end - 1] == '\r') {
+            --end;
+        }
+        co_yield text.substr(start, end - start);
+        start = next;
+    }
+}
+
+// ===================== MyString / 原始缓冲区重载 =====================
+inline std::string_view view(const MyString& s) {
+    return std::string_view(s.data(), s.size());
+}
+
+inline Generator<std::string_view> split(const MyString& s, char delim) { return split(view(s), delim); }
+inline Generator<std::string_view> tokenize(const MyString& s, std::string_view delims = " \t\r\n") {
+    return tokenize(view(s), delims);
+}
+inline Generator<std::string_view> lines(const MyString& s) { return lines(view(s)); }
+
+// 临时 MyString 在生成器遍历前就已析构，产出的 view 会悬空：直接禁止
+Generator<std::string_view> split(MyString&&, char) = delete;
+Generator<std::string_view> tokenize(MyString&&, std::string_view = {}) = delete;
+Generator<std::string_view> lines(MyString&&) = delete;
+
+// 字符串字面量：同时可以隐式转换为 string_view 和 MyString，显式给出重载避免二义性
+inline Generator<std::string_view> split(const char* text, char delim) { return split(std::string_view(text), delim); }
+inline Generator<std::string_view> tokenize(const char* text, std::string_view delims = " \t\r\n") {
+    return tokenize(std::string_view(text), delims);
+}
+inline Generator<std::string_view> lines(const char* text) { return lines(std::string_view(text)); }
+
+// 原始缓冲区 [data, data + len)，不要求以 '\0' 结尾
+inline Generator<std::string_view> split(const char* data, std::size_t len, char delim) {
+    return split(std::string_view(data, len), delim);
+}
+inline Generator<std::string_view> lines(const char* data, std::size_t len) {
+    return lines(std::string_view(data, len));
+}
+
+// ===================== 组合适配器 =====================
+// 上游 Generator 按值接收（移动进协程帧），由下游协程负责它的生命周期
+template<typename T, typename Pred>
+Generator<T> filter(Generator<T> source, Pred pred) {
+    for (auto&& value : source) {
+        if (pred(value)) {
+            co_yield value;
+        }
+    }
+}
+
+template<typename T, typename F>
+auto map(Generator<T> source, F f) -> Generator<std::invoke_result_t<F&, std::remove_reference_t<T>&>> {
+    for (auto&& value : source) {
+        co_yield f(value);
+    }
+}
+
+template<typename T>
+Generator<T> take(Generator<T> source, std::size_t n) {
+    if (n == 0) {
+        co_return;
+    }
+    for (auto&& value : source) {
+        co_yield value;
+        if (--n == 0) {
+            co_return;   // 不再恢复上游：剩余数据不会被扫描
+        }
+    }
+}
+
+} // namespace lazy
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+
+// 基类：定义虚函数接口
+class Animal {
+public:
+    // 虚函数：允许子类重写，实现多态
+    virtual void makeSound() const {
+        std::cout << sound() << std::endl;
+    }
+
+    // 只返回叫声、不直接输出：多线程并行处理时先收集结果，再按顺序打印
+    virtual std::string sound() const {
+        return "动物发出声音";
+    }
+    
+    // 虚析构函数：确保子类对象正确释放
+    virtual ~Animal() {
+        std::cout << "Animal 析构函数" << std::endl;
+    }
+    
+    // 普通函数：不会触发多态
+    void eat() const {
+        std::cout << "动物在吃东西" << std::endl;
+    }
+};
+
+// 子类1：重写虚函数
+class Dog : public Animal {
+public:
+    // override 关键字：明确表示重写父类虚函数（C++11）
+    void makeSound() const override {
+        std::cout << sound() << std::endl;
+    }
+
+    std::string sound() const override {
+        return "汪汪汪！";
+    }
+    
+    ~Dog() override {
+        std::cout << "Dog 析构函数" << std::endl;
+    }
+};
+
+// 子类2：重写虚函数
+class Cat : public Animal {
+public:
+    void makeSound() const override {
+        std::cout << sound() << std::endl;
+    }
+
+    std::string sound() const override {
+        return "喵喵喵！";
+    }
+    
+    ~Cat() override {
+        std::cout << "Cat 析构函数" << std::endl;
+    }
+};
@@ -1,4 +1,8 @@
 #include <iostream>
+#include <string>
+#include <vector>
+#include "animal.h"
+#include "../线程池/work_stealing_pool.h"
 
 /*
 核心定位: 多态（Polymorphism）是 C++ 面向对象编程的核心特性
@@ -27,49 +31,7 @@ void print(const std::string& value) {
 // 实现方式：虚函数（virtual）+ 继承 + 父类指针/引用
 // 特点：程序运行时才确定调用哪个函数
 
-// 基类：定义虚函数接口
-class Animal {
-public:
-    // 虚函数：允许子类重写，实现多态
-    virtual void makeSound() const {
-        std::cout << "动物发出声音" << std::endl;
-    }
-    
-    // 虚析构函数：确保子类对象正确释放
-    virtual ~Animal() {
-        std::cout << "Animal 析构函数" << std::endl;
-    }
-    
-    // 普通函数：不会触发多态
-    void eat() const {
-        std::cout << "动物在吃东西" << std::endl;
-    }
-};
-
-// 子类1：重写虚函数
-class Dog : public Animal {
-public:
-    // override 关键字：明确表示重写父类虚函数（C++11）
-    void makeSound() const override {
-        std::cout << "汪汪汪！" << std::endl;
-    }
-    
-    ~Dog() override {
-        std::cout << "Dog 析构函数" << std::endl;
-    }
-};
-
-// 子类2：重写虚函数
-class Cat : public Animal {
-public:
-    void makeSound() const override {
-        std::cout << "喵喵喵！" << std::endl;
-    }
-    
-    ~Cat() override {
-        std::cout << "Cat 析构函数" << std::endl;
-    }
-};
+// 基类 Animal 及子类 Dog / Cat 定义在 animal.h 中
 
 // ===================== 三、多态的核心条件演示 =====================
 void demonstratePolymorphism() {
@@ -131,6 +93,20 @@ void processAnimals(Animal* animals[], int count) {
     }
 }
 
+// 并行版本：多态调用与线程调度无关，每个元素交给线程池中的任意线程执行
+// 执行顺序不确定，但结果按下标收集后统一打印，输出顺序与数组顺序一致
+void processAnimalsParallel(Animal* animals[], int count, WorkStealingPool& pool) {
+    std::cout << "\n===== 实际应用：线程池并行处理不同对象 =====" << std::endl;
+    // 多个线程同时写 std::cout 会让输出交错：各任务只把结果写入自己的下标，结束后再按顺序打印
+    std::vector<std::string> sounds(count);
+    parallel_for(pool, 0, count, [animals, &sounds](std::size_t i) {
+        sounds[i] = animals[i]->sound();
+    });
+    for (int i = 0; i < count; i++) {
+        std::cout << sounds[i] << std::endl;
+    }
+}
+
 int main(int argc, char* argv[]) {
     std::cout << "===== 静态多态：函数重载 =====" << std::endl;
     print(10);           // 调用 print(int)
@@ -144,6 +120,9 @@ int main(int argc, char* argv[]) {
     // 实际应用场景
     Animal* animals[] = {new Dog(), new Cat(), new Dog()};
     processAnimals(animals, 3);
+
+    WorkStealingPool pool(2);
+    processAnimalsParallel(animals, 3, pool);
     
     // 清理内存
     for (int i = 0; i < 3; i++) {
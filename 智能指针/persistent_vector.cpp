@@ -0,0 +1,53 @@
+#include <iostream>
+#include <string>
+#include "persistent_vector.h"
+
+/*
+核心定位: 演示 persistent_vector.h 中的持久化向量
+每次修改都得到一个新版本，旧版本保持不变，且新旧版本共享未修改的节点
+*/
+
+void printVector(const std::string& name, const PersistentVector<int>& v) {
+    std::cout << name << " (size " << v.size() << "):";
+    v.forEach([](int x) { std::cout << " " << x; });
+    std::cout << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "===== 1. push_back 返回新版本 =====" << std::endl;
+    PersistentVector<int> v0;
+    PersistentVector<int> v1 = v0.push_back(1);
+    PersistentVector<int> v2 = v1.push_back(2);
+    printVector("v0", v0);
+    printVector("v1", v1);
+    printVector("v2", v2);
+
+    std::cout << "\n===== 2. set 只复制一条路径，旧版本不受影响 =====" << std::endl;
+    PersistentVector<int> v3 = v2.set(0, 100);
+    printVector("v2", v2);
+    printVector("v3", v3);
+
+    std::cout << "\n===== 3. transient 批量构建，再发布快照 =====" << std::endl;
+    TransientVector<int> builder = PersistentVector<int>().transient();
+    for (int i = 0; i < 100000; i++) {
+        builder.push_back(i);   // 独占节点原地修改，没有路径复制
+    }
+    PersistentVector<int> big = builder.persistent();
+    builder.set(0, -1);         // 快照已发布：被共享的节点写时复制，big 不受影响
+    std::cout << "big.size() = " << big.size() << " big[0] = " << big[0]
+              << " big[99999] = " << big[99999] << std::endl;
+    std::cout << "builder[0] = " << builder[0] << std::endl;
+
+    std::cout << "\n===== 4. 快照：拷贝一个版本只是拷贝两个 SharedPtr =====" << std::endl;
+    PersistentVector<int> snapshot = big;
+    PersistentVector<int> changed = big.set(50000, 0);
+    std::cout << "snapshot[50000] = " << snapshot[50000] << " changed[50000] = " << changed[50000] << std::endl;
+
+    try {
+        big.at(100000);
+    } catch (const std::out_of_range& e) {
+        std::cout << "越界访问: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "shared_ptr_design.h"
+
+/*
+核心定位: 持久化（不可变、结构共享）向量，节点由项目自己的 SharedPtr 持有
+- 结构：32 叉前缀树（trie）+ 尾部缓冲区（tail），下标按 5 位一组逐层定位
+- push_back / set 不修改原对象，而是返回新版本：只复制根到目标叶子的一条路径（O(log32 n) 个节点），
+  其余节点通过 SharedPtr 在新旧版本之间共享
+- 拷贝一个版本 = 拷贝两个 SharedPtr，可以 O(1) 地给并发读者发快照（SharedPtr 的计数是原子的）
+- TransientVector：批量构建模式。节点引用计数为 1 时说明只被自己持有，直接原地修改；
+  否则先复制再修改，所以 transient 与已发布的快照之间互不影响
+要求：T 可拷贝构造
+*/
+
+namespace pvec_detail {
+
+constexpr unsigned kBits = 5;
+constexpr std::size_t kWidth = std::size_t(1) << kBits;   // 32
+constexpr std::size_t kMask = kWidth - 1;
+
+// 叶子节点：最多 32 个元素
+template<typename T>
+struct Leaf {
+    std::vector<T> values;
+
+    Leaf() { values.reserve(kWidth); }
+    // 复制时同样预留 32 个位置，之后往尾部追加不再重新分配
+    Leaf(const Leaf& other) {
+        values.reserve(kWidth);
+        values.insert(values.end(), other.values.begin(), other.values.end());
+    }
+};
+
+// 内部节点：位于叶子上一层（level == kBits）时子节点是 leaves，否则是 inners
+template<typename T>
+struct Inner {
+    std::vector<SharedPtr<Inner>> inners;
+    std::vector<SharedPtr<Leaf<T>>> leaves;
+};
+
+// 节点独占时返回可写指针；被共享时先复制一份（写时复制）
+template<typename Node>
+Node* editable(SharedPtr<Node>& node) {
+    if (!node.unique()) {
+        node = SharedPtr<Node>(new Node(*node));
+    }
+    return node.get();
+}
+
+} // namespace pvec_detail
+
+// 节点是高频内部对象，关闭 SharedPtr 的教学日志
+template<typename T>
+struct SharedPtrLog<pvec_detail::Leaf<T>> {
+    static constexpr bool enabled = false;
+};
+
+template<typename T>
+struct SharedPtrLog<pvec_detail::Inner<T>> {
+    static constexpr bool enabled = false;
+};
+
+template<typename T>
+class TransientVector;
+
+// ===================== 一、PersistentVector：不可变版本 =====================
+template<typename T>
+class PersistentVector {
+public:
+    using Leaf = pvec_detail::Leaf<T>;
+    using Inner = pvec_detail::Inner<T>;
+
+    PersistentVector() : m_size_(0), m_shift_(pvec_detail::kBits), m_root_(new Inner()), m_tail_(new Leaf()) {}
+
+    std::size_t size() const { return m_size_; }
+    bool empty() const { return m_size_ == 0; }
+
+    // 随机访问：最多 log32(n) 次指针跳转
+    const T& operator[](std::size_t i) const {
+        return leafFor(i).values[i & pvec_detail::kMask];
+    }
+
+    const T& at(std::size_t i) const {
+        if (i >= m_size_) {
+            throw std::out_of_range("PersistentVector::at");
+        }
+        return (*this)[i];
+    }
+
+    // 返回追加了 value 的新版本，当前版本不变
+    PersistentVector push_back(T value) const {
+        PersistentVector next(*this);
+        if (m_size_ - tailOffset() < pvec_detail::kWidth) {
+            // 尾部未满：只复制尾部（最多 32 个元素）
+            next.m_tail_ = SharedPtr<Leaf>(new Leaf(*m_tail_));
+        } else {
+            // 尾部已满：整块挂进树中，再开一个新尾部
+            if ((m_size_ >> pvec_detail::kBits) > (std::size_t(1) << m_shift_)) {
+                // 根节点已满：树长高一层
+                SharedPtr<Inner> root(new Inner());
+                root->inners.push_back(m_root_);
+                root->inners.push_back(newPath(m_shift_, m_tail_));
+                next.m_root_ = root;
+                next.m_shift_ = m_shift_ + pvec_detail::kBits;
+            } else {
+                next.m_root_ = pushTail(m_shift_, *m_root_, m_tail_);
+            }
+            next.m_tail_ = SharedPtr<Leaf>(new Leaf());
+        }
+        next.m_tail_->values.push_back(std::move(value));
+        next.m_size_ = m_size_ + 1;
+        return next;
+    }
+
+    // 返回第 i 个元素被替换后的新版本，只复制根到该叶子的路径
+    PersistentVector set(std::size_t i, T value) const {
+        if (i >= m_size_) {
+            throw std::out_of_range("PersistentVector::set");
+        }
+        PersistentVector next(*this);
+        if (i >= tailOffset()) {
+            next.m_tail_ = SharedPtr<Leaf>(new Leaf(*m_tail_));
+            next.m_tail_->values[i & pvec_detail::kMask] = std::move(value);
+        } else {
+            next.m_root_ = assoc(m_shift_, *m_root_, i, std::move(value));
+        }
+        return next;
+    }
+
+    // 进入批量构建模式
+    TransientVector<T> transient() const { return TransientVector<T>(*this); }
+
+    // 按顺序访问所有元素：每个叶子只定位一次
+    template<typename F>
+    void forEach(F&& f) const {
+        const std::size_t tail_off = tailOffset();
+        for (std::size_t base = 0; base < tail_off; base += pvec_detail::kWidth) {
+            for (const T& v : leafFor(base).values) {
+                f(v);
+            }
+        }
+        for (const T& v : m_tail_->values) {
+            f(v);
+        }
+    }
+
+private:
+    friend class TransientVector<T>;
+
+    // 尾部缓冲区第一个元素的下标：之前的元素都在树中
+    std::size_t tailOffset() const {
+        return m_size_ < pvec_detail::kWidth ? 0 : ((m_size_ - 1) >> pvec_detail::kBits) << pvec_detail::kBits;
+    }
+
+    const Leaf& leafFor(std::size_t i) const {
+        if (i >= tailOffset()) {
+            return *m_tail_;
+        }
+        const Inner* node = m_root_.get();
+        for (unsigned level = m_shift_; level > pvec_detail::kBits; level -= pvec_detail::kBits) {
+            node = node->inners[(i >> level) & pvec_detail::kMask].get();
+        }
+        return *node->leaves[(i >> pvec_detail::kBits) & pvec_detail::kMask];
+    }
+
+    // 构造一条从 level 层到叶子 leaf 的单链路径
+    static SharedPtr<Inner> newPath(unsigned level, const SharedPtr<Leaf>& leaf) {
+        SharedPtr<Inner> node(new Inner());
+        if (level == pvec_detail::kBits) {
+            node->leaves.push_back(leaf);
+        } else {
+            node->inners.push_back(newPath(level - pvec_detail::kBits, leaf));
+        }
+        return node;
+    }
+
+    // 把已满的尾部挂到树的最右侧，沿途节点复制，其余子节点共享
+    SharedPtr<Inner> pushTail(unsigned level, const Inner& parent, const SharedPtr<Leaf>& tail) const {
+        SharedPtr<Inner> node(new Inner(parent));
+        if (level == pvec_detail::kBits) {
+            node->leaves.push_back(tail);
+            return node;
+        }
+        const std::size_t idx = ((m_size_ - 1) >> level) & pvec_detail::kMask;
+        if (idx < parent.inners.size()) {
+            node->inners[idx] = pushTail(level - pvec_detail::kBits, *parent.inners[idx], tail);
+        } else {
+            node->inners.push_back(newPath(level - pvec_detail::kBits, tail));
+        }
+        return node;
+    }
+
+    static SharedPtr<Inner> assoc(unsigned level, const Inner& parent, std::size_t i, T value) {
+        SharedPtr<Inner> node(new Inner(parent));
+        const std::size_t idx = (i >> level) & pvec_detail::kMask;
+        if (level == pvec_detail::kBits) {
+            SharedPtr<Leaf> leaf(new Leaf(*parent.leaves[idx]));
+            leaf->values[i & pvec_detail::kMask] = std::move(value);
+            node->leaves[idx] = leaf;
+        } else {
+            node->inners[idx] = assoc(level - pvec_detail::kBits, *parent.inners[idx], i, std::move(value));
+        }
+        return node;
+    }
+
+    std::size_t m_size_;
+    unsigned m_shift_;          // 根节点所在层的位移量（kBits 的整数倍）
+    SharedPtr<Inner> m_root_;
+    SharedPtr<Leaf> m_tail_;
+};
+
+// ===================== 二、TransientVector：批量构建模式 =====================
+// 与 PersistentVector 共享节点；独占的节点原地修改，共享的节点写时复制
+// persistent() 发布一个不可变快照，之后 transient 仍可继续使用（被共享的节点会在下次写入时复制）
+template<typename T>
+class TransientVector {
+public:
+    using Leaf = pvec_detail::Leaf<T>;
+    using Inner = pvec_detail::Inner<T>;
+
+    explicit TransientVector(const PersistentVector<T>& base) : m_vec_(base) {}
+
+    std::size_t size() const { return m_vec_.m_size_; }
+    const T& operator[](std::size_t i) const { return m_vec_[i]; }
+
+    TransientVector& push_back(T value) {
+        PersistentVector<T>& v = m_vec_;
+        if (v.m_size_ - v.tailOffset() == pvec_detail::kWidth) {
+            if ((v.m_size_ >> pvec_detail::kBits) > (std::size_t(1) << v.m_shift_)) {
+                SharedPtr<Inner> root(new Inner());
+                root->inners.push_back(std::move(v.m_root_));
+                root->inners.push_back(PersistentVector<T>::newPath(v.m_shift_, v.m_tail_));
+                v.m_root_ = std::move(root);
+                v.m_shift_ += pvec_detail::kBits;
+            } else {
+                pushTail(v.m_shift_, v.m_root_, v.m_tail_);
+            }
+            v.m_tail_ = SharedPtr<Leaf>(new Leaf());
+        }
+        pvec_detail::editable(v.m_tail_)->values.push_back(std::move(value));
+        ++v.m_size_;
+        return *this;
+    }
+
+    TransientVector& set(std::size_t i, T value) {
+        PersistentVector<T>& v = m_vec_;
+        if (i >= v.m_size_) {
+            throw std::out_of_range("TransientVector::set");
+        }
+        if (i >= v.tailOffset()) {
+            pvec_detail::editable(v.m_tail_)->values[i & pvec_detail::kMask] = std::move(value);
+            return *this;
+        }
+        Inner* node = pvec_detail::editable(v.m_root_);
+        for (unsigned level = v.m_shift_; level > pvec_detail::kBits; level -= pvec_detail::kBits) {
+            node = pvec_detail::editable(node->inners[(i >> level) & pvec_detail::kMask]);
+        }
+        Leaf* leaf = pvec_detail::editable(node->leaves[(i >> pvec_detail::kBits) & pvec_detail::kMask]);
+        leaf->values[i & pvec_detail::kMask] = std::move(value);
+        return *this;
+    }
+
+    // 发布不可变快照
+    PersistentVector<T> persistent() const { return m_vec_; }
+
+private:
+    void pushTail(unsigned level, SharedPtr<Inner>& node, const SharedPtr<Leaf>& tail) {
+        Inner* n = pvec_detail::editable(node);
+        if (level == pvec_detail::kBits) {
+            n->leaves.push_back(tail);
+            return;
+        }
+        const std::size_t idx = ((m_vec_.m_size_ - 1) >> level) & pvec_detail::kMask;
+        if (idx < n->inners.size()) {
+            pushTail(level - pvec_detail::kBits, n->inners[idx], tail);
+        } else {
+            n->inners.push_back(PersistentVector<T>::newPath(level - pvec_detail::kBits, tail));
+        }
+    }
+
+    PersistentVector<T> m_vec_;
+};
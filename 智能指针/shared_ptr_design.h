@@ -0,0 +1,132 @@
+#pragma once
+
+#include <iostream>
+#include <utility>
+#include <atomic>   // 原子引用计数：多个线程各自拷贝/析构 SharedPtr 时计数仍然正确
+
+// 第零步：教学日志开关，默认打印构造/释放过程
+// 作为容器内部节点等高频对象使用时，对节点类型特化为 false 关闭日志（编译期判断，无运行时开销）
+template<typename T>
+struct SharedPtrLog {
+    static constexpr bool enabled = true;
+};
+
+// 第一步：定义引用计数控制块
+template<typename T>
+struct RefCount {
+    T* resource;    // 指向实际资源
+    std::atomic<int> ref_count;  // 引用计数
+    // 构造函数
+    RefCount(T* ptr) : resource(ptr), ref_count(1) {
+        if constexpr (SharedPtrLog<T>::enabled) {
+            std::cout << "RefCount 构造函数调用" << std::endl;
+        }
+    }
+    // 析构函数
+    ~RefCount() {
+        delete resource;
+        if constexpr (SharedPtrLog<T>::enabled) {
+            std::cout << "资源已释放" << std::endl;
+        }
+    }
+    // 增加引用计数：只需保证原子性，不需要同步其他内存
+    void add_ref() {
+        ref_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    // 减少引用计数，返回是否减到 0
+    // acq_rel：保证最后一个持有者析构资源前，能看到其他线程对资源的全部写入
+    bool release_ref() {
+        return ref_count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+};
+
+// 第二步：实现自定义 shared_ptr 类
+template<typename T>
+class SharedPtr {
+public:
+    // 1. 构造函数：接收裸指针
+    explicit SharedPtr(T* ptr = nullptr) : m_ptr_(ptr) {
+        if(ptr) {
+            cb = new RefCount<T>(ptr);
+        } else {
+            cb = nullptr;
+        }
+        if constexpr (SharedPtrLog<T>::enabled) {
+            std::cout << "SharedPtr 构造函数调用" << std::endl;
+        }
+    }
+    // 2. 拷贝构造函数：共享资源，计数+1
+    SharedPtr(const SharedPtr<T>& other) {
+        m_ptr_ = other.m_ptr_;
+        cb = other.cb;
+        if (cb) {
+            cb->add_ref();  // 引用计数+1
+        }
+    }
+
+    // 3. 拷贝赋值运算符：先释放当前资源，再共享新资源
+    SharedPtr<T>& operator=(const SharedPtr<T>& other) {
+        if (this == &other) {  // 防止自赋值
+            return *this;
+        }
+
+        // 释放当前资源：计数-1，若为0则销毁控制块
+        if (cb && cb->release_ref()) {
+            delete cb;
+        }
+
+        // 共享新资源
+        m_ptr_ = other.m_ptr_;
+        cb = other.cb;
+        if (cb) {
+            cb->add_ref();
+        }
+
+        return *this;
+    }
+
+    // 移动构造 / 移动赋值：直接接管控制块，计数不变
+    SharedPtr(SharedPtr<T>&& other) noexcept : m_ptr_(other.m_ptr_), cb(other.cb) {
+        other.m_ptr_ = nullptr;
+        other.cb = nullptr;
+    }
+
+    SharedPtr<T>& operator=(SharedPtr<T>&& other) noexcept {
+        if (this != &other) {
+            if (cb && cb->release_ref()) {
+                delete cb;
+            }
+            m_ptr_ = other.m_ptr_;
+            cb = other.cb;
+            other.m_ptr_ = nullptr;
+            other.cb = nullptr;
+        }
+        return *this;
+    }
+
+    // 4. 析构函数：计数-1，若为0则销毁控制块
+    ~SharedPtr() {
+        if (cb && cb->release_ref()) {
+            delete cb;  // 控制块析构时会释放资源
+        }
+    }
+
+    // 5. 重载解引用和箭头运算符：模拟原生指针行为
+    T& operator*() const { return *m_ptr_; }
+    T* operator->() const { return m_ptr_; }
+    T* get() const { return m_ptr_; }
+    explicit operator bool() const { return m_ptr_ != nullptr; }
+
+    // 6. 获取引用计数（辅助函数）
+    int use_count() const {
+        return cb ? cb->ref_count.load(std::memory_order_acquire) : 0;
+    }
+
+    // 7. 判断是否独占资源
+    bool unique() const {
+        return use_count() == 1;
+    }
+private:
+    T* m_ptr_;
+    RefCount<T>* cb;
+};
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "any_value.h"
+
+/*
+核心定位: 演示 any_value.h 中的类型擦除容器 AnyValue
+MyContainer<T>（template.cpp）只能装编译期确定的一种 T，
+AnyValue 可以在同一个容器里装不同类型的值，且小对象不需要堆分配
+编译：g++ -std=c++17 any_value.cpp -o any_value
+*/
+
+struct Big {
+    double values[16];   // 128 字节，超过默认内联缓冲区，存到堆上
+};
+
+int main(int argc, char* argv[]) {
+    std::cout << "===== 1. 编译期决定存储方式 =====" << std::endl;
+    std::cout << std::boolalpha;
+    std::cout << "int          内联: " << AnyValue::storedInline<int>()
+              << "  memcpy 路径: " << AnyValue::kMemcpyPath<int> << std::endl;
+    std::cout << "std::string  内联: " << AnyValue::storedInline<std::string>()
+              << "  memcpy 路径: " << AnyValue::kMemcpyPath<std::string> << std::endl;
+    std::cout << "Big          内联: " << AnyValue::storedInline<Big>()
+              << "  memcpy 路径: " << AnyValue::kMemcpyPath<Big> << std::endl;
+    std::cout << "更大的缓冲区 BasicAnyValue<256> 中 Big 内联: " << BasicAnyValue<256>::storedInline<Big>() << std::endl;
+
+    std::cout << "\n===== 2. 同一个容器装不同类型 =====" << std::endl;
+    std::vector<AnyValue> values;
+    values.emplace_back(42);
+    values.emplace_back(std::string("hello"));
+    values.emplace_back(3.14);
+    values.emplace_back(Big{{1.0}});
+
+    for (AnyValue& v : values) {
+        bool handled = v.visit<int, double, std::string>([](const auto& x) {
+            std::cout << "visit: " << x << std::endl;
+        });
+        if (!handled) {
+            std::cout << "visit: 未列出的类型（Big），values[0] = " << v.get<Big>().values[0] << std::endl;
+        }
+    }
+
+    std::cout << "\n===== 3. 拷贝 / 移动 / 类型检查 =====" << std::endl;
+    AnyValue a = std::string("copy me");
+    AnyValue b = a;                 // 深拷贝 std::string
+    AnyValue c = std::move(a);      // 移动：a 变为空
+    std::cout << "b: " << b.get<std::string>() << "  c: " << c.get<std::string>()
+              << "  a.has_value(): " << a.has_value() << std::endl;
+    std::cout << "c.is<int>(): " << c.is<int>() << "  c.get_if<int>(): " << c.get_if<int>() << std::endl;
+
+    try {
+        c.get<int>();
+    } catch (const BadAnyValueCast& e) {
+        std::cout << "捕获异常: " << e.what() << std::endl;
+    }
+
+    return 0;
+}
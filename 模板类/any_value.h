@@ -0,0 +1,262 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/*
+核心定位: 类型擦除的值容器 AnyValue —— 一个对象可以装任意可拷贝类型的值
+对比 MyContainer<T>：T 在编译期固定；AnyValue 在运行期才决定装什么类型
+
+实现要点：
+1. 小对象优化（SBO）：sizeof/alignof 不超过模板参数 Size/Align 且移动不抛异常的类型直接存放在对象内部，
+   其余类型才在堆上分配
+2. 手写虚函数表（VTable）：每个类型一张编译期常量表，保存 销毁 / 拷贝 / 移动 函数指针，
+   不依赖 RTTI（typeid）也不依赖虚函数；类型判断直接比较表的地址
+3. 编译期特性检查：可平凡拷贝（trivially copyable）的内联类型，表中的函数指针为空，
+   拷贝/移动直接 memcpy 整块缓冲区，析构什么也不做；堆上的对象移动时只交换指针
+*/
+
+// 取值类型不匹配时抛出
+class BadAnyValueCast : public std::exception {
+public:
+    const char* what() const noexcept override { return "BadAnyValueCast: 存储的类型与请求的类型不一致"; }
+};
+
+template<std::size_t Size = 4 * sizeof(void*), std::size_t Align = alignof(std::max_align_t)>
+class BasicAnyValue {
+    static_assert(Size >= sizeof(void*), "内联缓冲区至少要能放下一个指针（堆存储时使用）");
+    static_assert((Align & (Align - 1)) == 0 && Align >= alignof(void*), "Align 必须是 2 的幂且不小于指针对齐");
+
+    union Storage {
+        alignas(Align) unsigned char buffer[Size];
+        void* heap;
+    };
+
+    // 函数指针为空表示走 memcpy 路径
+    struct VTable {
+        void (*destroy)(Storage&) noexcept;
+        void (*copy)(const Storage& src, Storage& dst);
+        void (*move)(Storage& src, Storage& dst) noexcept;   // 移动后负责销毁 src 中的对象
+        void* (*get)(Storage&) noexcept;
+    };
+
+public:
+    // ===================== 编译期特性 =====================
+    template<typename T>
+    static constexpr bool kStoredInline = sizeof(T) <= Size && alignof(T) <= Align &&
+                                          std::is_nothrow_move_constructible_v<T>;
+
+    template<typename T>
+    static constexpr bool kMemcpyPath = kStoredInline<T> && std::is_trivially_copyable_v<T>;
+
+    BasicAnyValue() noexcept = default;
+
+    template<typename T, typename D = std::decay_t<T>,
+             typename = std::enable_if_t<!std::is_same_v<D, BasicAnyValue>>>
+    BasicAnyValue(T&& value) {
+        construct<D>(std::forward<T>(value));
+    }
+
+    // 原地构造：emplace<T>(构造参数...)
+    template<typename T, typename... Args>
+    T& emplace(Args&&... args) {
+        reset();
+        return *construct<T>(std::forward<Args>(args)...);
+    }
+
+    BasicAnyValue(const BasicAnyValue& other) { copyFrom(other); }
+
+    BasicAnyValue(BasicAnyValue&& other) noexcept { moveFrom(other); }
+
+    BasicAnyValue& operator=(const BasicAnyValue& other) {
+        if (this != &other) {
+            BasicAnyValue tmp(other);   // 先拷贝：拷贝抛异常时当前对象保持不变
+            reset();
+            moveFrom(tmp);
+        }
+        return *this;
+    }
+
+    BasicAnyValue& operator=(BasicAnyValue&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    ~BasicAnyValue() { reset(); }
+
+    void reset() noexcept {
+        if (m_vtable_ && m_vtable_->destroy) {
+            m_vtable_->destroy(m_storage_);
+        }
+        m_vtable_ = nullptr;
+    }
+
+    bool has_value() const noexcept { return m_vtable_ != nullptr; }
+
+    // 类型判断：比较虚函数表地址，不需要 RTTI
+    template<typename T>
+    bool is() const noexcept {
+        return m_vtable_ == &kVTable<T>;
+    }
+
+    template<typename T>
+    T* get_if() noexcept {
+        return is<T>() ? static_cast<T*>(m_vtable_->get(m_storage_)) : nullptr;
+    }
+
+    template<typename T>
+    const T* get_if() const noexcept {
+        return const_cast<BasicAnyValue*>(this)->template get_if<T>();
+    }
+
+    template<typename T>
+    T& get() {
+        if (T* p = get_if<T>()) {
+            return *p;
+        }
+        throw BadAnyValueCast();
+    }
+
+    template<typename T>
+    const T& get() const {
+        return const_cast<BasicAnyValue*>(this)->template get<T>();
+    }
+
+    // 依次尝试 Ts 中的类型，命中时调用 f(值) 并返回 true
+    template<typename... Ts, typename F>
+    bool visit(F&& f) {
+        return (tryVisit<Ts>(f) || ...);
+    }
+
+    template<typename T>
+    static constexpr bool storedInline() { return kStoredInline<T>; }
+
+private:
+    template<typename T, typename... Args>
+    T* construct(Args&&... args) {
+        static_assert(std::is_copy_constructible_v<T>, "AnyValue 只能保存可拷贝的类型");
+        T* p;
+        if constexpr (kStoredInline<T>) {
+            p = ::new (static_cast<void*>(m_storage_.buffer)) T(std::forward<Args>(args)...);
+        } else {
+            p = new T(std::forward<Args>(args)...);
+            m_storage_.heap = p;
+        }
+        m_vtable_ = &kVTable<T>;
+        return p;
+    }
+
+    template<typename T, typename F>
+    bool tryVisit(F& f) {
+        if (T* p = get_if<T>()) {
+            f(*p);
+            return true;
+        }
+        return false;
+    }
+
+    void copyFrom(const BasicAnyValue& other) {
+        if (!other.m_vtable_) {
+            return;
+        }
+        if (other.m_vtable_->copy) {
+            other.m_vtable_->copy(other.m_storage_, m_storage_);
+        } else {
+            std::memcpy(&m_storage_, &other.m_storage_, sizeof(Storage));
+        }
+        m_vtable_ = other.m_vtable_;
+    }
+
+    void moveFrom(BasicAnyValue& other) noexcept {
+        if (!other.m_vtable_) {
+            return;
+        }
+        if (other.m_vtable_->move) {
+            other.m_vtable_->move(other.m_storage_, m_storage_);
+        } else {
+            // 平凡类型或堆指针：整块拷贝即完成转移
+            std::memcpy(&m_storage_, &other.m_storage_, sizeof(Storage));
+        }
+        m_vtable_ = other.m_vtable_;
+        other.m_vtable_ = nullptr;
+    }
+
+    // ===================== 每个类型一张的虚函数表 =====================
+    template<typename T>
+    static T* inlinePtr(Storage& s) noexcept {
+        return std::launder(reinterpret_cast<T*>(s.buffer));
+    }
+
+    template<typename T>
+    static const T* inlinePtr(const Storage& s) noexcept {
+        return std::launder(reinterpret_cast<const T*>(s.buffer));
+    }
+
+    template<typename T>
+    static void* getImpl(Storage& s) noexcept {
+        if constexpr (kStoredInline<T>) {
+            return inlinePtr<T>(s);
+        } else {
+            return s.heap;
+        }
+    }
+
+    template<typename T>
+    static void destroyImpl(Storage& s) noexcept {
+        if constexpr (kStoredInline<T>) {
+            inlinePtr<T>(s)->~T();
+        } else {
+            delete static_cast<T*>(s.heap);
+        }
+    }
+
+    template<typename T>
+    static void copyImpl(const Storage& src, Storage& dst) {
+        if constexpr (kStoredInline<T>) {
+            ::new (static_cast<void*>(dst.buffer)) T(*inlinePtr<T>(src));
+        } else {
+            dst.heap = new T(*static_cast<const T*>(src.heap));
+        }
+    }
+
+    template<typename T>
+    static void moveImpl(Storage& src, Storage& dst) noexcept {
+        ::new (static_cast<void*>(dst.buffer)) T(std::move(*inlinePtr<T>(src)));
+        inlinePtr<T>(src)->~T();
+    }
+
+    template<typename T>
+    static constexpr VTable makeVTable() {
+        VTable vt{nullptr, nullptr, nullptr, &getImpl<T>};
+        if constexpr (kMemcpyPath<T>) {
+            // 可平凡拷贝的内联类型：全部走 memcpy，析构为空操作
+            return vt;
+        } else if constexpr (kStoredInline<T>) {
+            vt.destroy = &destroyImpl<T>;
+            vt.copy = &copyImpl<T>;
+            vt.move = &moveImpl<T>;
+            return vt;
+        } else {
+            // 堆对象：移动只需转移指针（move 为空 → memcpy 指针）
+            vt.destroy = &destroyImpl<T>;
+            vt.copy = &copyImpl<T>;
+            return vt;
+        }
+    }
+
+    template<typename T>
+    static constexpr VTable kVTable = makeVTable<T>();
+
+    Storage m_storage_;
+    const VTable* m_vtable_ = nullptr;
+};
+
+// 默认配置：4 个指针大小（64 位下 32 字节）的内联缓冲区，可以放下 std::string
+using AnyValue = BasicAnyValue<>;
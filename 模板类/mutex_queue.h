@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <queue>
+#include <utility>
+
+/*
+核心定位: 环形缓冲区的基准对照组 —— "std::mutex + std::queue" 实现的有界队列
+接口与 SpscRingBuffer / MpmcRingBuffer 一致（try_push / try_pop / push_n / pop_n），
+ring_buffer.cpp 的演示基准和 benchmark/bench_ring_buffer.cpp 共用这一份实现
+*/
+
+template<typename T>
+class MutexQueue {
+public:
+    explicit MutexQueue(std::size_t capacity) : m_capacity_(capacity) {}
+
+    bool try_push(T&& value) {
+        std::lock_guard<std::mutex> lock(m_mutex_);
+        if (m_queue_.size() >= m_capacity_) {
+            return false;
+        }
+        m_queue_.push(std::move(value));
+        return true;
+    }
+
+    bool try_pop(T& out) {
+        std::lock_guard<std::mutex> lock(m_mutex_);
+        if (m_queue_.empty()) {
+            return false;
+        }
+        out = std::move(m_queue_.front());
+        m_queue_.pop();
+        return true;
+    }
+
+    // 批量版本：一次加锁搬运多个元素，与环形缓冲区的 push_n / pop_n 公平对比
+    template<typename InputIt>
+    std::size_t push_n(InputIt first, std::size_t n) {
+        std::lock_guard<std::mutex> lock(m_mutex_);
+        std::size_t count = 0;
+        for (; count < n && m_queue_.size() < m_capacity_; ++count, ++first) {
+            m_queue_.push(std::move(*first));
+        }
+        return count;
+    }
+
+    template<typename OutputIt>
+    std::size_t pop_n(OutputIt out, std::size_t n) {
+        std::lock_guard<std::mutex> lock(m_mutex_);
+        std::size_t count = 0;
+        for (; count < n && !m_queue_.empty(); ++count, ++out) {
+            *out = std::move(m_queue_.front());
+            m_queue_.pop();
+        }
+        return count;
+    }
+
+private:
+    std::size_t m_capacity_;
+    std::mutex m_mutex_;
+    std::queue<T> m_queue_;
+};
@@ -0,0 +1,228 @@
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+#include "ring_buffer.h"
+#include "mutex_queue.h"
+
+/*
+核心定位: 演示 ring_buffer.h 中的 SPSC / MPMC 环形缓冲区，
+并与 "std::mutex + std::queue" 对比吞吐量和端到端延迟
+编译：g++ -std=c++17 -O2 -pthread ring_buffer.cpp -o ring_buffer
+*/
+
+// ===================== 一、基本用法 =====================
+struct Message {
+    int id;
+    std::string payload;
+
+    Message() : id(0) {}
+    Message(int i, std::string p) : id(i), payload(std::move(p)) {}
+};
+
+void demonstrateBasicUsage() {
+    std::cout << "===== SPSC 基本用法 =====" << std::endl;
+    SpscRingBuffer<Message> spsc(4);  // 容量向上取整为 2 的幂
+    std::cout << "capacity: " << spsc.capacity() << std::endl;
+
+    spsc.try_emplace(1, "hello");                 // 原地构造，参数完美转发
+    spsc.try_push(Message(2, "world"));           // 右值：移动入队
+    Message out;
+    while (spsc.try_pop(out)) {
+        std::cout << "pop id " << out.id << " payload " << out.payload << std::endl;
+    }
+
+    std::cout << "\n===== MPMC 批量 push_n / pop_n =====" << std::endl;
+    MpmcRingBuffer<int> mpmc(8);
+    std::vector<int> input = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::size_t pushed = mpmc.push_n(input.begin(), input.size());  // 只能放下 8 个
+    std::cout << "push_n 入队个数: " << pushed << std::endl;
+
+    std::vector<int> output(input.size());
+    std::size_t popped = mpmc.pop_n(output.begin(), output.size());
+    std::cout << "pop_n 出队个数: " << popped << " 内容:";
+    for (std::size_t i = 0; i < popped; i++) {
+        std::cout << " " << output[i];
+    }
+    std::cout << std::endl;
+}
+
+// ===================== 二、吞吐量 / 延迟基准（对照组见 mutex_queue.h） =====================
+// 每个元素携带入队时刻，消费者出队时计算端到端延迟
+using Clock = std::chrono::steady_clock;
+
+static std::int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+}
+
+struct BenchResult {
+    double mops;          // 吞吐量：百万元素/秒
+    double p50_ns;        // 延迟中位数
+    double p99_ns;        // 延迟 99 分位
+};
+
+template<typename Queue>
+BenchResult runBenchmark(Queue& queue, int producers, int consumers, std::size_t items_per_producer) {
+    const std::size_t total = items_per_producer * producers;
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::vector<std::int64_t>> latencies(consumers);
+
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&] {
+            for (std::size_t i = 0; i < items_per_producer; i++) {
+                std::int64_t stamp = nowNs();
+                while (!queue.try_push(std::move(stamp))) {
+                    std::this_thread::yield();  // 队列满：让出 CPU
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c] {
+            std::vector<std::int64_t>& local = latencies[c];
+            local.reserve(total / consumers + 1);
+            std::int64_t stamp = 0;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.try_pop(stamp)) {
+                    local.push_back(nowNs() - stamp);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<std::int64_t> all;
+    for (auto& local : latencies) {
+        all.insert(all.end(), local.begin(), local.end());
+    }
+    std::sort(all.begin(), all.end());
+    BenchResult result;
+    result.mops = total / seconds / 1e6;
+    result.p50_ns = all.empty() ? 0 : all[all.size() / 2];
+    result.p99_ns = all.empty() ? 0 : all[all.size() * 99 / 100];
+    return result;
+}
+
+// 批量版本：生产者每次 push_n 一批带时间戳的元素，消费者每次 pop_n 最多一批
+template<typename Queue>
+BenchResult runBatchBenchmark(Queue& queue, int producers, int consumers, std::size_t items_per_producer,
+                              std::size_t batch) {
+    const std::size_t total = items_per_producer * producers;
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::vector<std::int64_t>> latencies(consumers);
+
+    auto start = Clock::now();
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&] {
+            std::vector<std::int64_t> stamps(batch);
+            for (std::size_t sent = 0; sent < items_per_producer;) {
+                const std::size_t n = std::min(batch, items_per_producer - sent);
+                std::fill_n(stamps.begin(), n, nowNs());
+                std::size_t done = 0;
+                while (done < n) {
+                    const std::size_t pushed = queue.push_n(stamps.begin() + done, n - done);
+                    if (pushed == 0) {
+                        std::this_thread::yield();
+                    }
+                    done += pushed;
+                }
+                sent += n;
+            }
+        });
+    }
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&, c] {
+            std::vector<std::int64_t>& local = latencies[c];
+            local.reserve(total / consumers + batch);
+            std::vector<std::int64_t> stamps(batch);
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                const std::size_t popped = queue.pop_n(stamps.begin(), batch);
+                if (popped == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                const std::int64_t now = nowNs();
+                for (std::size_t i = 0; i < popped; i++) {
+                    local.push_back(now - stamps[i]);
+                }
+                consumed.fetch_add(popped, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::vector<std::int64_t> all;
+    for (auto& local : latencies) {
+        all.insert(all.end(), local.begin(), local.end());
+    }
+    std::sort(all.begin(), all.end());
+    BenchResult result;
+    result.mops = total / seconds / 1e6;
+    result.p50_ns = all.empty() ? 0 : all[all.size() / 2];
+    result.p99_ns = all.empty() ? 0 : all[all.size() * 99 / 100];
+    return result;
+}
+
+void printResult(const std::string& name, int producers, int consumers, const BenchResult& r) {
+    std::cout << std::left << std::setw(12) << name
+              << " P" << producers << "/C" << consumers
+              << std::right << std::fixed << std::setprecision(2)
+              << "  吞吐 " << std::setw(8) << r.mops << " Mops/s"
+              << "  p50 " << std::setw(10) << r.p50_ns << " ns"
+              << "  p99 " << std::setw(12) << r.p99_ns << " ns" << std::endl;
+}
+
+void benchmarkQueues() {
+    std::cout << "\n===== 基准：环形缓冲区 vs mutex + std::queue =====" << std::endl;
+    std::cout << "硬件线程数: " << std::thread::hardware_concurrency() << std::endl;
+    const std::size_t kCapacity = 1024;
+    const std::size_t kItems = 200000;
+    const std::size_t kBatch = 32;
+
+    {
+        SpscRingBuffer<std::int64_t> spsc(kCapacity);
+        printResult("spsc", 1, 1, runBenchmark(spsc, 1, 1, kItems));
+    }
+
+    const int configs[][2] = {{1, 1}, {2, 2}, {4, 4}};
+    for (const auto& cfg : configs) {
+        MpmcRingBuffer<std::int64_t> mpmc(kCapacity);
+        printResult("mpmc", cfg[0], cfg[1], runBenchmark(mpmc, cfg[0], cfg[1], kItems / cfg[0]));
+        MutexQueue<std::int64_t> locked(kCapacity);
+        printResult("mutex+queue", cfg[0], cfg[1], runBenchmark(locked, cfg[0], cfg[1], kItems / cfg[0]));
+    }
+
+    std::cout << "\n===== 基准：批量 push_n / pop_n（每批 " << kBatch << " 个）=====" << std::endl;
+    {
+        SpscRingBuffer<std::int64_t> spsc(kCapacity);
+        printResult("spsc_n", 1, 1, runBatchBenchmark(spsc, 1, 1, kItems, kBatch));
+    }
+    for (const auto& cfg : configs) {
+        MpmcRingBuffer<std::int64_t> mpmc(kCapacity);
+        printResult("mpmc_n", cfg[0], cfg[1], runBatchBenchmark(mpmc, cfg[0], cfg[1], kItems / cfg[0], kBatch));
+        MutexQueue<std::int64_t> locked(kCapacity);
+        printResult("mutex_n", cfg[0], cfg[1], runBatchBenchmark(locked, cfg[0], cfg[1], kItems / cfg[0], kBatch));
+    }
+}
+
+int main(int argc, char* argv[]) {
+    demonstrateBasicUsage();
+    benchmarkQueues();
+    return 0;
+}
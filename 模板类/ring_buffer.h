@@ -0,0 +1,368 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/*
+核心定位: 有界环形缓冲区（Ring Buffer），作为流水线各阶段之间的交接队列
+- SpscRingBuffer<T>：单生产者/单消费者，wait-free（每个操作步数有上界，无 CAS 重试）
+- MpmcRingBuffer<T>：多生产者/多消费者，lock-free（基于每个槽位的序号，Vyukov 算法）
+共同点：
+1. 容量在构造时确定，向上取整为 2 的幂，用 & mask 代替 % 取模
+2. 读写下标各自独占一条缓存行（alignas），避免生产者/消费者之间的伪共享（false sharing）
+3. 元素在槽位里原地构造（placement new + 完美转发），不要求 T 可默认构造
+4. 支持批量 push_n / pop_n：一次同步操作搬运多个元素，摊薄原子操作开销
+*/
+
+// 缓存行大小：x86/ARM 常见值为 64 字节
+constexpr std::size_t kCacheLineSize = 64;
+
+namespace ring_detail {
+
+// 把容量向上取整为 2 的幂（最小为 2）；超过 size_t 能表示的最大 2 的幂时抛出 std::length_error
+inline std::size_t roundUpPow2(std::size_t n) {
+    if (n > std::numeric_limits<std::size_t>::max() / 2 + 1) {
+        throw std::length_error("ring buffer 容量过大：无法向上取整为 2 的幂");
+    }
+    std::size_t cap = 2;
+    while (cap < n) {
+        cap <<= 1;
+    }
+    return cap;
+}
+
+// 未初始化的对齐存储：元素只在 push 时构造、pop 时析构
+template<typename T>
+struct RawSlot {
+    alignas(T) unsigned char bytes[sizeof(T)];
+
+    T* ptr() { return std::launder(reinterpret_cast<T*>(bytes)); }
+};
+
+} // namespace ring_detail
+
+// ===================== 一、SPSC：单生产者 / 单消费者 =====================
+// 下标 head_/tail_ 单调递增（不回绕），size = tail - head
+// 生产者只写 tail_，消费者只写 head_，双方各自缓存对方下标，减少跨核读取
+template<typename T>
+class SpscRingBuffer {
+public:
+    explicit SpscRingBuffer(std::size_t capacity)
+        : m_capacity_(ring_detail::roundUpPow2(capacity)),
+          m_mask_(m_capacity_ - 1),
+          m_slots_(new ring_detail::RawSlot<T>[m_capacity_]) {}
+
+    // 析构：销毁仍留在队列中的元素
+    ~SpscRingBuffer() {
+        std::size_t head = m_head_.load(std::memory_order_relaxed);
+        std::size_t tail = m_tail_.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) {
+            m_slots_[head & m_mask_].ptr()->~T();
+        }
+    }
+
+    // 队列持有原子下标和原始存储，禁止拷贝/移动
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    // 原地构造：参数完美转发给 T 的构造函数，队列满时返回 false
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        const std::size_t tail = m_tail_.load(std::memory_order_relaxed);
+        if (tail - m_cached_head_ == m_capacity_) {
+            m_cached_head_ = m_head_.load(std::memory_order_acquire);
+            if (tail - m_cached_head_ == m_capacity_) {
+                return false;
+            }
+        }
+        ::new (m_slots_[tail & m_mask_].bytes) T(std::forward<Args>(args)...);
+        m_tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value) { return try_emplace(value); }
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    // 出队：移动到 out，队列空时返回 false
+    bool try_pop(T& out) {
+        const std::size_t head = m_head_.load(std::memory_order_relaxed);
+        if (head == m_cached_tail_) {
+            m_cached_tail_ = m_tail_.load(std::memory_order_acquire);
+            if (head == m_cached_tail_) {
+                return false;
+            }
+        }
+        T* slot = m_slots_[head & m_mask_].ptr();
+        out = std::move(*slot);
+        slot->~T();
+        m_head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 批量入队：从 first 开始移动最多 n 个元素，只发布一次 tail_，返回实际入队个数
+    template<typename InputIt>
+    std::size_t push_n(InputIt first, std::size_t n) {
+        const std::size_t tail = m_tail_.load(std::memory_order_relaxed);
+        std::size_t free = m_capacity_ - (tail - m_cached_head_);
+        if (free < n) {
+            m_cached_head_ = m_head_.load(std::memory_order_acquire);
+            free = m_capacity_ - (tail - m_cached_head_);
+        }
+        const std::size_t count = free < n ? free : n;
+        std::size_t built = 0;
+        try {
+            for (; built < count; ++built, ++first) {
+                ::new (m_slots_[(tail + built) & m_mask_].bytes) T(std::move(*first));
+            }
+        } catch (...) {
+            // 构造中途抛异常：本批尚未发布，销毁已构造的元素后原样抛出，队列状态不变
+            for (std::size_t i = 0; i < built; ++i) {
+                m_slots_[(tail + i) & m_mask_].ptr()->~T();
+            }
+            throw;
+        }
+        if (count > 0) {
+            m_tail_.store(tail + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    // 批量出队：最多 n 个元素移动写入 out，只发布一次 head_，返回实际出队个数
+    template<typename OutputIt>
+    std::size_t pop_n(OutputIt out, std::size_t n) {
+        const std::size_t head = m_head_.load(std::memory_order_relaxed);
+        std::size_t avail = m_cached_tail_ - head;
+        if (avail < n) {
+            m_cached_tail_ = m_tail_.load(std::memory_order_acquire);
+            avail = m_cached_tail_ - head;
+        }
+        const std::size_t count = avail < n ? avail : n;
+        std::size_t taken = 0;
+        try {
+            for (; taken < count; ++taken, ++out) {
+                T* slot = m_slots_[(head + taken) & m_mask_].ptr();
+                *out = std::move(*slot);
+                slot->~T();
+            }
+        } catch (...) {
+            // 赋值中途抛异常：已取走的元素照常发布，抛异常的元素及其后的元素留在队列中
+            if (taken > 0) {
+                m_head_.store(head + taken, std::memory_order_release);
+            }
+            throw;
+        }
+        if (count > 0) {
+            m_head_.store(head + count, std::memory_order_release);
+        }
+        return count;
+    }
+
+    // 近似元素个数（并发时仅供参考）
+    std::size_t size_approx() const {
+        return m_tail_.load(std::memory_order_acquire) - m_head_.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const { return m_capacity_; }
+
+private:
+    const std::size_t m_capacity_;
+    const std::size_t m_mask_;
+    std::unique_ptr<ring_detail::RawSlot<T>[]> m_slots_;
+
+    // 消费者侧缓存行：自己的 head_ + 对 tail_ 的本地缓存
+    alignas(kCacheLineSize) std::atomic<std::size_t> m_head_{0};
+    std::size_t m_cached_tail_ = 0;
+
+    // 生产者侧缓存行：自己的 tail_ + 对 head_ 的本地缓存
+    alignas(kCacheLineSize) std::atomic<std::size_t> m_tail_{0};
+    std::size_t m_cached_head_ = 0;
+    // 不需要尾部填充：成员带 alignas，sizeof 已向上取整到缓存行的整数倍
+};
+
+// ===================== 二、MPMC：多生产者 / 多消费者 =====================
+// 每个槽位带一个序号 sequence：
+//   sequence == pos      → 槽位空闲，可被 pos 号生产者写入
+//   sequence == pos + 1  → 槽位已写入，可被 pos 号消费者读取
+// 生产者/消费者通过 CAS 抢占 enqueue_pos_/dequeue_pos_，抢到后独占该槽位
+// 抢到槽位后的操作不能失败：入队时构造抛异常，消费者会卡在该槽位；出队时赋值抛异常，
+// 该槽位的 sequence 不会推进到下一轮，生产者回绕到这里时会永远认为队列已满
+// 因此要求 T 的移动构造和移动赋值都为 noexcept；可能抛异常的构造放在抢占之前完成（见 try_emplace）
+template<typename T>
+class MpmcRingBuffer {
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "MpmcRingBuffer 要求 T 的移动构造为 noexcept：抢到槽位后构造失败会使队列永久阻塞");
+    static_assert(std::is_nothrow_move_assignable_v<T>,
+                  "MpmcRingBuffer 要求 T 的移动赋值为 noexcept：出队赋值失败会使槽位永远无法复用");
+
+public:
+    explicit MpmcRingBuffer(std::size_t capacity)
+        : m_capacity_(ring_detail::roundUpPow2(capacity)),
+          m_mask_(m_capacity_ - 1),
+          m_cells_(new Cell[m_capacity_]) {
+        for (std::size_t i = 0; i < m_capacity_; ++i) {
+            m_cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpmcRingBuffer() {
+        std::size_t head = m_dequeue_pos_.load(std::memory_order_relaxed);
+        std::size_t tail = m_enqueue_pos_.load(std::memory_order_relaxed);
+        for (; head != tail; ++head) {
+            m_cells_[head & m_mask_].slot.ptr()->~T();
+        }
+    }
+
+    MpmcRingBuffer(const MpmcRingBuffer&) = delete;
+    MpmcRingBuffer& operator=(const MpmcRingBuffer&) = delete;
+
+    template<typename... Args>
+    bool try_emplace(Args&&... args) {
+        if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+            return emplaceNoexcept(std::forward<Args>(args)...);
+        } else {
+            // 构造可能抛异常：先在抢占槽位之前构造临时对象，抢到后再 noexcept 移动进去
+            return emplaceNoexcept(T(std::forward<Args>(args)...));
+        }
+    }
+
+    bool try_push(const T& value) { return try_emplace(value); }
+    bool try_push(T&& value) { return try_emplace(std::move(value)); }
+
+    bool try_pop(T& out) {
+        std::size_t pos = m_dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells_[pos & m_mask_];
+            const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+            if (diff == 0) {
+                if (m_dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    T* slot = cell.slot.ptr();
+                    out = std::move(*slot);
+                    slot->~T();
+                    cell.sequence.store(pos + m_capacity_, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // 槽位尚未写入：队列空
+            } else {
+                pos = m_dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 批量入队：从 pos 起扫描连续空闲的槽位，一次 CAS 抢占整段 [pos, pos + count)
+    // 扫描到的空闲槽位只能由抢到对应 pos 的生产者改写，所以 CAS 成功后整段都归当前线程
+    template<typename InputIt>
+    std::size_t push_n(InputIt first, std::size_t n) {
+        static_assert(std::is_nothrow_constructible_v<T, decltype(std::move(*first))>,
+                      "push_n 在抢占整段槽位后才构造元素，要求构造不抛异常");
+        std::size_t pos = m_enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            std::size_t count = 0;
+            while (count < n &&
+                   m_cells_[(pos + count) & m_mask_].sequence.load(std::memory_order_acquire) == pos + count) {
+                ++count;
+            }
+            if (count == 0) {
+                const std::size_t seq = m_cells_[pos & m_mask_].sequence.load(std::memory_order_acquire);
+                if (static_cast<std::ptrdiff_t>(seq - pos) < 0) {
+                    return 0;  // 队列满
+                }
+                pos = m_enqueue_pos_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (m_enqueue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                for (std::size_t i = 0; i < count; ++i, ++first) {
+                    Cell& cell = m_cells_[(pos + i) & m_mask_];
+                    ::new (cell.slot.bytes) T(std::move(*first));
+                    cell.sequence.store(pos + i + 1, std::memory_order_release);
+                }
+                return count;
+            }
+        }
+    }
+
+    // 批量出队：从 pos 起扫描连续已写入的槽位，一次 CAS 抢占整段
+    template<typename OutputIt>
+    std::size_t pop_n(OutputIt out, std::size_t n) {
+        static_assert(std::is_nothrow_assignable_v<decltype(*out), T&&>,
+                      "pop_n 在抢占整段槽位后才逐个赋值，要求写入 out 不抛异常");
+        std::size_t pos = m_dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            std::size_t count = 0;
+            while (count < n &&
+                   m_cells_[(pos + count) & m_mask_].sequence.load(std::memory_order_acquire) == pos + count + 1) {
+                ++count;
+            }
+            if (count == 0) {
+                const std::size_t seq = m_cells_[pos & m_mask_].sequence.load(std::memory_order_acquire);
+                if (static_cast<std::ptrdiff_t>(seq - (pos + 1)) < 0) {
+                    return 0;  // 队列空
+                }
+                pos = m_dequeue_pos_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (m_dequeue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                for (std::size_t i = 0; i < count; ++i, ++out) {
+                    Cell& cell = m_cells_[(pos + i) & m_mask_];
+                    T* slot = cell.slot.ptr();
+                    *out = std::move(*slot);
+                    slot->~T();
+                    cell.sequence.store(pos + i + m_capacity_, std::memory_order_release);
+                }
+                return count;
+            }
+        }
+    }
+
+    std::size_t size_approx() const {
+        const std::size_t tail = m_enqueue_pos_.load(std::memory_order_acquire);
+        const std::size_t head = m_dequeue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    std::size_t capacity() const { return m_capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        ring_detail::RawSlot<T> slot;
+    };
+
+    // 抢占槽位并原地构造：调用方保证构造不抛异常
+    template<typename... Args>
+    bool emplaceNoexcept(Args&&... args) noexcept {
+        std::size_t pos = m_enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_cells_[pos & m_mask_];
+            const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                // 槽位空闲：抢占 pos，失败时 pos 被更新为最新值后重试
+                if (m_enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ::new (cell.slot.bytes) T(std::forward<Args>(args)...);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // 槽位仍被上一轮元素占用：队列满
+            } else {
+                pos = m_enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    const std::size_t m_capacity_;
+    const std::size_t m_mask_;
+    std::unique_ptr<Cell[]> m_cells_;
+
+    // 生产者和消费者的抢占下标分处不同缓存行
+    alignas(kCacheLineSize) std::atomic<std::size_t> m_enqueue_pos_{0};
+    alignas(kCacheLineSize) std::atomic<std::size_t> m_dequeue_pos_{0};
+};
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <string>
+#include <utility>
 
 // 模板声明：template <模板参数列表>
 template <typename T> // T是类型参数（可替换任意类型：如int/string/自定义类）
@@ -11,7 +13,8 @@ public:
     // 2.成员函数：返回值/参数使用T
     // T getValue() const {return m_data_;}
     T getValue() const;
-    void setValue(T val) {m_data_ = val;}
+    // 按值传参 + std::move：左值实参拷贝一次，右值实参只移动，不再多拷贝一次
+    void setValue(T val) {m_data_ = std::move(val);}
 
 private:
     T m_data_;
@@ -19,7 +22,7 @@ private:
 
 // 类外定义：必须重复template <typename T>,且类名写MyContainer<T>
 template <typename T>
-MyContainer<T>::MyContainer(T val) : m_data_(val) {}
+MyContainer<T>::MyContainer(T val) : m_data_(std::move(val)) {}
 
 template <typename T>
 T MyContainer<T>::getValue() const {
@@ -36,5 +39,7 @@ int main(int argc, char *argv[])
     MyContainer<std::string> string_container("hello");
     std::cout << "string container value " << string_container.getValue() << std::endl;
 
+    // 需要在线程之间传递多个 T 时，见 ring_buffer.h 中的 SpscRingBuffer<T> / MpmcRingBuffer<T>
+    // 需要在同一个容器里保存运行期才确定的不同类型时，见 any_value.h 中的 AnyValue
     return 0;
 }
\ No newline at end of file
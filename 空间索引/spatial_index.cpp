@@ -0,0 +1,486 @@
+#include "spatial_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using spatial_detail::Entry;
+
+namespace {
+
+// 距离平方的内部表示：int 坐标差最大 2^32 - 1，平方和最大约 2^65，超出 64 位，用 128 位无符号整数精确计算
+using Dist2 = unsigned __int128;
+
+// 半径的上限：任意两个 int 坐标点的距离都小于 2^33，更大的半径等价于 2^33，平方后仍在 128 位以内
+constexpr std::int64_t kMaxRadius = std::int64_t{1} << 33;
+
+Dist2 square(std::int64_t v) {
+    const std::uint64_t a = static_cast<std::uint64_t>(v < 0 ? -v : v);
+    return static_cast<Dist2>(a) * a;
+}
+
+Dist2 dist2(const Point& a, const Point& b) {
+    return square(static_cast<std::int64_t>(a.x()) - b.x()) + square(static_cast<std::int64_t>(a.y()) - b.y());
+}
+
+// 对外报告的距离平方：超过 UINT64_MAX 时饱和（只有相距超过约 4.29e9 的点对才会出现）
+std::uint64_t saturate(Dist2 d) {
+    const std::uint64_t max = std::numeric_limits<std::uint64_t>::max();
+    return d > max ? max : static_cast<std::uint64_t>(d);
+}
+
+std::int64_t clampRadius(std::int64_t r) {
+    return std::min(r, kMaxRadius);
+}
+
+int coord(const Point& p, unsigned axis) {
+    return axis == 0 ? p.x() : p.y();
+}
+
+// kNN 候选：排序用精确的 128 位距离平方
+struct Candidate {
+    Dist2 dist2;
+    std::size_t index;
+};
+
+// 距离相同时按下标排序，保证各种实现的 kNN 结果完全一致
+bool closer(const Candidate& a, const Candidate& b) {
+    return a.dist2 != b.dist2 ? a.dist2 < b.dist2 : a.index < b.index;
+}
+
+// 容量为 k 的大顶堆：堆顶是当前第 k 近的候选
+class KnnHeap {
+public:
+    explicit KnnHeap(std::size_t k) : m_k_(k) { m_items_.reserve(k); }
+
+    bool full() const { return m_items_.size() == m_k_; }
+    Dist2 worst() const { return m_items_.front().dist2; }
+
+    void offer(const Candidate& n) {
+        if (!full()) {
+            m_items_.push_back(n);
+            std::push_heap(m_items_.begin(), m_items_.end(), closer);
+        } else if (closer(n, m_items_.front())) {
+            std::pop_heap(m_items_.begin(), m_items_.end(), closer);
+            m_items_.back() = n;
+            std::push_heap(m_items_.begin(), m_items_.end(), closer);
+        }
+    }
+
+    // 取出结果：按距离从近到远
+    std::vector<Neighbor> take() {
+        std::sort_heap(m_items_.begin(), m_items_.end(), closer);
+        std::vector<Neighbor> result;
+        result.reserve(m_items_.size());
+        for (const Candidate& c : m_items_) {
+            result.push_back(Neighbor{c.index, saturate(c.dist2)});
+        }
+        return result;
+    }
+
+private:
+    std::size_t m_k_;
+    std::vector<Candidate> m_items_;
+};
+
+void offerEntry(KnnHeap& heap, const Entry& e, const Point& q) {
+    heap.offer(Candidate{dist2(e.point, q), e.id});
+}
+
+bool inBox(const Point& p, const Point& lo, const Point& hi) {
+    return p.x() >= lo.x() && p.x() <= hi.x() && p.y() >= lo.y() && p.y() <= hi.y();
+}
+
+// 批量查询：有线程池时每个查询作为 parallel_for 的一个下标
+template<typename R, typename F>
+std::vector<R> runBatch(std::size_t n, WorkStealingPool* pool, F&& query) {
+    std::vector<R> results(n);
+    if (pool) {
+        parallel_for(*pool, 0, n, [&](std::size_t i) { results[i] = query(i); });
+    } else {
+        for (std::size_t i = 0; i < n; i++) {
+            results[i] = query(i);
+        }
+    }
+    return results;
+}
+
+std::vector<Entry> makeEntries(const std::vector<Point>& points) {
+    if (points.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("空间索引最多支持 2^32 - 1 个点");
+    }
+    std::vector<Entry> entries;
+    entries.reserve(points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+        entries.push_back(Entry{points[i], static_cast<std::uint32_t>(i)});
+    }
+    return entries;
+}
+
+// ===================== k-d 树的递归查询 =====================
+// 节点隐式表示：区间 [lo, hi) 的中点 mid 是切分点，depth 决定切分轴（偶数 x，奇数 y）
+void kdKnn(const std::vector<Entry>& es, std::size_t lo, std::size_t hi, unsigned depth,
+           const Point& q, KnnHeap& heap) {
+    if (hi - lo <= KdTree::kLeafSize) {
+        for (std::size_t i = lo; i < hi; i++) {
+            offerEntry(heap, es[i], q);
+        }
+        return;
+    }
+    const std::size_t mid = lo + (hi - lo) / 2;
+    const unsigned axis = depth & 1;
+    const std::int64_t diff = static_cast<std::int64_t>(coord(q, axis)) - coord(es[mid].point, axis);
+    offerEntry(heap, es[mid], q);
+
+    // 先搜查询点所在的一侧，再用到切分线的距离判断另一侧是否可能有更近的点
+    const bool left_first = diff < 0;
+    if (left_first) {
+        kdKnn(es, lo, mid, depth + 1, q, heap);
+    } else {
+        kdKnn(es, mid + 1, hi, depth + 1, q, heap);
+    }
+    // 用 <= 而不是 <：另一侧可能有距离相同但下标更小的点
+    if (!heap.full() || square(diff) <= heap.worst()) {
+        if (left_first) {
+            kdKnn(es, mid + 1, hi, depth + 1, q, heap);
+        } else {
+            kdKnn(es, lo, mid, depth + 1, q, heap);
+        }
+    }
+}
+
+// 矩形查询：[lo, hi] 与切分线的关系决定进入哪一侧；radius 查询也复用它（外接正方形 + 距离过滤）
+template<typename Accept>
+void kdRange(const std::vector<Entry>& es, std::size_t lo, std::size_t hi, unsigned depth,
+             const Point& box_lo, const Point& box_hi, const Accept& accept, std::vector<std::size_t>& out) {
+    if (hi - lo <= KdTree::kLeafSize) {
+        for (std::size_t i = lo; i < hi; i++) {
+            if (accept(es[i].point)) {
+                out.push_back(es[i].id);
+            }
+        }
+        return;
+    }
+    const std::size_t mid = lo + (hi - lo) / 2;
+    const unsigned axis = depth & 1;
+    const int split = coord(es[mid].point, axis);
+    if (accept(es[mid].point)) {
+        out.push_back(es[mid].id);
+    }
+    if (coord(box_lo, axis) <= split) {
+        kdRange(es, lo, mid, depth + 1, box_lo, box_hi, accept, out);
+    }
+    if (coord(box_hi, axis) >= split) {
+        kdRange(es, mid + 1, hi, depth + 1, box_lo, box_hi, accept, out);
+    }
+}
+
+// 半径查询的外接正方形（坐标夹到 int 范围内）
+Point boundingLo(const Point& q, std::int64_t r) {
+    const std::int64_t lo = std::numeric_limits<int>::min();
+    return Point(static_cast<int>(std::max(lo, q.x() - r)), static_cast<int>(std::max(lo, q.y() - r)));
+}
+
+Point boundingHi(const Point& q, std::int64_t r) {
+    const std::int64_t hi = std::numeric_limits<int>::max();
+    return Point(static_cast<int>(std::min(hi, q.x() + r)), static_cast<int>(std::min(hi, q.y() + r)));
+}
+
+} // namespace
+
+// ===================== 一、KdTree =====================
+KdTree::KdTree(const std::vector<Point>& points, WorkStealingPool* pool) : m_entries_(makeEntries(points)) {
+    if (pool && m_entries_.size() > kParallelThreshold) {
+        TaskGroup group(*pool);
+        build(0, m_entries_.size(), 0, &group);
+        group.wait();
+    } else {
+        build(0, m_entries_.size(), 0, nullptr);
+    }
+}
+
+void KdTree::build(std::size_t lo, std::size_t hi, unsigned depth, TaskGroup* group) {
+    if (hi - lo <= kLeafSize) {
+        return;
+    }
+    const std::size_t mid = lo + (hi - lo) / 2;
+    const unsigned axis = depth & 1;
+    // nth_element 之后：[lo, mid) <= mid <= (mid, hi)，平均 O(n)，整棵树 O(n log n)
+    std::nth_element(m_entries_.begin() + lo, m_entries_.begin() + mid, m_entries_.begin() + hi,
+                     [axis](const Entry& a, const Entry& b) { return coord(a.point, axis) < coord(b.point, axis); });
+
+    // 左右子树互不重叠，可以并行构建；区间太小时任务开销大于收益，直接递归
+    if (group && mid - lo > kParallelThreshold) {
+        group->run([this, lo, mid, depth, group] { build(lo, mid, depth + 1, group); });
+        build(mid + 1, hi, depth + 1, group);
+    } else {
+        build(lo, mid, depth + 1, nullptr);
+        build(mid + 1, hi, depth + 1, nullptr);
+    }
+}
+
+std::vector<Neighbor> KdTree::knn(const Point& q, std::size_t k) const {
+    if (k == 0 || m_entries_.empty()) {
+        return {};
+    }
+    KnnHeap heap(std::min(k, m_entries_.size()));
+    kdKnn(m_entries_, 0, m_entries_.size(), 0, q, heap);
+    return heap.take();
+}
+
+std::vector<std::size_t> KdTree::radius(const Point& q, std::int64_t r) const {
+    std::vector<std::size_t> out;
+    if (r < 0) {
+        return out;
+    }
+    r = clampRadius(r);
+    const Dist2 r2 = square(r);
+    kdRange(m_entries_, 0, m_entries_.size(), 0, boundingLo(q, r), boundingHi(q, r),
+            [&](const Point& p) { return dist2(p, q) <= r2; }, out);
+    return out;
+}
+
+std::vector<std::size_t> KdTree::box(const Point& lo, const Point& hi) const {
+    std::vector<std::size_t> out;
+    kdRange(m_entries_, 0, m_entries_.size(), 0, lo, hi,
+            [&](const Point& p) { return inBox(p, lo, hi); }, out);
+    return out;
+}
+
+std::vector<std::vector<Neighbor>> KdTree::knnBatch(const std::vector<Point>& queries, std::size_t k,
+                                                    WorkStealingPool* pool) const {
+    return runBatch<std::vector<Neighbor>>(queries.size(), pool, [&](std::size_t i) { return knn(queries[i], k); });
+}
+
+std::vector<std::vector<std::size_t>> KdTree::radiusBatch(const std::vector<Point>& queries, std::int64_t r,
+                                                          WorkStealingPool* pool) const {
+    return runBatch<std::vector<std::size_t>>(queries.size(), pool,
+                                              [&](std::size_t i) { return radius(queries[i], r); });
+}
+
+// ===================== 二、UniformGrid =====================
+UniformGrid::UniformGrid(const std::vector<Point>& points, std::int64_t cell_size, WorkStealingPool* pool) {
+    if (points.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("空间索引最多支持 2^32 - 1 个点");
+    }
+    if (cell_size < 0) {
+        throw std::invalid_argument("UniformGrid: cell_size 不能为负数");
+    }
+    const std::size_t n = points.size();
+    if (n == 0) {
+        m_cell_ = cell_size > 0 ? cell_size : 1;
+        m_cell_start_.assign(2, 0);
+        return;
+    }
+
+    // 1. 包围盒
+    std::int64_t max_x = points[0].x(), max_y = points[0].y();
+    m_min_x_ = max_x;
+    m_min_y_ = max_y;
+    for (const Point& p : points) {
+        m_min_x_ = std::min<std::int64_t>(m_min_x_, p.x());
+        m_min_y_ = std::min<std::int64_t>(m_min_y_, p.y());
+        max_x = std::max<std::int64_t>(max_x, p.x());
+        max_y = std::max<std::int64_t>(max_y, p.y());
+    }
+    const std::int64_t width = max_x - m_min_x_ + 1;
+    const std::int64_t height = max_y - m_min_y_ + 1;
+
+    // 2. 格子大小：默认让平均每格 kTargetPerCell 个点；格子总数不超过点数的若干倍，避免稀疏分布撑爆内存
+    if (cell_size == 0) {
+        const double area = static_cast<double>(width) * static_cast<double>(height);
+        cell_size = static_cast<std::int64_t>(std::ceil(std::sqrt(area * kTargetPerCell / static_cast<double>(n))));
+        cell_size = std::max<std::int64_t>(cell_size, 1);
+    }
+    // width / height 不超过 2^32，直接相乘可能溢出：用 cols > max_cells / rows 判断（先除后比较）
+    // 格子编号用 uint32 存储，格子总数同时受 UINT32_MAX 限制
+    const std::uint64_t max_cells = std::min<std::uint64_t>(static_cast<std::uint64_t>(n) * 4 + 16,
+                                                            std::numeric_limits<std::uint32_t>::max());
+    auto ceilDiv = [](std::int64_t a, std::int64_t b) { return static_cast<std::uint64_t>((a - 1) / b + 1); };
+    while (ceilDiv(width, cell_size) > max_cells / ceilDiv(height, cell_size)) {
+        cell_size *= 2;
+    }
+    m_cell_ = cell_size;
+    m_cols_ = static_cast<std::int64_t>(ceilDiv(width, m_cell_));
+    m_rows_ = static_cast<std::int64_t>(ceilDiv(height, m_cell_));
+
+    // 3. 每个点的格子编号（行优先）：互不依赖，有线程池时并行计算
+    std::vector<std::uint32_t> cell_of(n);
+    auto assign = [&](std::size_t i) {
+        cell_of[i] = static_cast<std::uint32_t>(cellY(points[i].y()) * m_cols_ + cellX(points[i].x()));
+    };
+    if (pool) {
+        parallel_for(*pool, 0, n, assign);
+    } else {
+        for (std::size_t i = 0; i < n; i++) {
+            assign(i);
+        }
+    }
+
+    // 4. 计数排序：统计每格点数 -> 前缀和得到起点 -> 按起点散列，同一格子内保持原始顺序
+    m_cell_start_.assign(cellCount() + 1, 0);
+    for (std::uint32_t c : cell_of) {
+        m_cell_start_[c + 1]++;
+    }
+    for (std::size_t c = 1; c < m_cell_start_.size(); c++) {
+        m_cell_start_[c] += m_cell_start_[c - 1];
+    }
+    std::vector<std::uint32_t> cursor(m_cell_start_.begin(), m_cell_start_.end() - 1);
+    m_entries_.assign(n, Entry{Point(0, 0), 0});
+    for (std::size_t i = 0; i < n; i++) {
+        m_entries_[cursor[cell_of[i]]++] = Entry{points[i], static_cast<std::uint32_t>(i)};
+    }
+}
+
+std::int64_t UniformGrid::cellX(std::int64_t x) const {
+    return std::clamp<std::int64_t>((x - m_min_x_) / m_cell_, 0, m_cols_ - 1);
+}
+
+std::int64_t UniformGrid::cellY(std::int64_t y) const {
+    return std::clamp<std::int64_t>((y - m_min_y_) / m_cell_, 0, m_rows_ - 1);
+}
+
+std::vector<Neighbor> UniformGrid::knn(const Point& q, std::size_t k) const {
+    if (k == 0 || m_entries_.empty()) {
+        return {};
+    }
+    KnnHeap heap(std::min(k, m_entries_.size()));
+    auto offer = [&](const Entry& e) { offerEntry(heap, e, q); };
+    const std::int64_t cx = cellX(q.x());
+    const std::int64_t cy = cellY(q.y());
+    const std::int64_t inf = std::numeric_limits<std::int64_t>::max();
+
+    // 以查询点所在格子为中心，一圈一圈向外扩展
+    for (std::int64_t r = 0;; r++) {
+        const std::int64_t x0 = std::max<std::int64_t>(cx - r, 0);
+        const std::int64_t x1 = std::min(cx + r, m_cols_ - 1);
+        if (r == 0) {
+            forEachInRow(cy, cx, cx, offer);
+        } else {
+            // 上下两行整段访问，左右两列逐格访问（不含四个角）
+            if (cy - r >= 0) {
+                forEachInRow(cy - r, x0, x1, offer);
+            }
+            if (cy + r < m_rows_) {
+                forEachInRow(cy + r, x0, x1, offer);
+            }
+            const std::int64_t y0 = std::max<std::int64_t>(cy - r + 1, 0);
+            const std::int64_t y1 = std::min(cy + r - 1, m_rows_ - 1);
+            for (std::int64_t y = y0; y <= y1; y++) {
+                if (cx - r >= 0) {
+                    forEachInRow(y, cx - r, cx - r, offer);
+                }
+                if (cx + r < m_cols_) {
+                    forEachInRow(y, cx + r, cx + r, offer);
+                }
+            }
+        }
+
+        // 尚未访问的点都在已访问方块之外：到方块各条边（网格边缘除外）的最短距离是它们距离的下界
+        std::int64_t bound = inf;
+        if (cx - r > 0) {
+            bound = std::min(bound, q.x() - (m_min_x_ + (cx - r) * m_cell_));
+        }
+        if (cx + r < m_cols_ - 1) {
+            bound = std::min(bound, m_min_x_ + (cx + r + 1) * m_cell_ - q.x());
+        }
+        if (cy - r > 0) {
+            bound = std::min(bound, q.y() - (m_min_y_ + (cy - r) * m_cell_));
+        }
+        if (cy + r < m_rows_ - 1) {
+            bound = std::min(bound, m_min_y_ + (cy + r + 1) * m_cell_ - q.y());
+        }
+        if (bound == inf) {
+            break;   // 整个网格都已访问
+        }
+        // 严格小于：距离恰好等于下界的点可能下标更小，仍需访问
+        if (heap.full() && heap.worst() < square(bound)) {
+            break;
+        }
+    }
+    return heap.take();
+}
+
+std::vector<std::size_t> UniformGrid::radius(const Point& q, std::int64_t r) const {
+    std::vector<std::size_t> out;
+    if (r < 0 || m_entries_.empty()) {
+        return out;
+    }
+    r = clampRadius(r);
+    const Dist2 r2 = square(r);
+    const std::int64_t x0 = cellX(q.x() - r), x1 = cellX(q.x() + r);
+    const std::int64_t y0 = cellY(q.y() - r), y1 = cellY(q.y() + r);
+    for (std::int64_t y = y0; y <= y1; y++) {
+        forEachInRow(y, x0, x1, [&](const Entry& e) {
+            if (dist2(e.point, q) <= r2) {
+                out.push_back(e.id);
+            }
+        });
+    }
+    return out;
+}
+
+std::vector<std::size_t> UniformGrid::box(const Point& lo, const Point& hi) const {
+    std::vector<std::size_t> out;
+    if (m_entries_.empty() || lo.x() > hi.x() || lo.y() > hi.y()) {
+        return out;
+    }
+    const std::int64_t x0 = cellX(lo.x()), x1 = cellX(hi.x());
+    const std::int64_t y0 = cellY(lo.y()), y1 = cellY(hi.y());
+    for (std::int64_t y = y0; y <= y1; y++) {
+        forEachInRow(y, x0, x1, [&](const Entry& e) {
+            if (inBox(e.point, lo, hi)) {
+                out.push_back(e.id);
+            }
+        });
+    }
+    return out;
+}
+
+std::vector<std::vector<Neighbor>> UniformGrid::knnBatch(const std::vector<Point>& queries, std::size_t k,
+                                                         WorkStealingPool* pool) const {
+    return runBatch<std::vector<Neighbor>>(queries.size(), pool, [&](std::size_t i) { return knn(queries[i], k); });
+}
+
+std::vector<std::vector<std::size_t>> UniformGrid::radiusBatch(const std::vector<Point>& queries, std::int64_t r,
+                                                               WorkStealingPool* pool) const {
+    return runBatch<std::vector<std::size_t>>(queries.size(), pool,
+                                              [&](std::size_t i) { return radius(queries[i], r); });
+}
+
+// ===================== 三、暴力扫描 =====================
+std::vector<Neighbor> bruteForceKnn(const std::vector<Point>& points, const Point& q, std::size_t k) {
+    if (k == 0 || points.empty()) {
+        return {};
+    }
+    KnnHeap heap(std::min(k, points.size()));
+    for (std::size_t i = 0; i < points.size(); i++) {
+        heap.offer(Candidate{dist2(points[i], q), i});
+    }
+    return heap.take();
+}
+
+std::vector<std::size_t> bruteForceRadius(const std::vector<Point>& points, const Point& q, std::int64_t r) {
+    std::vector<std::size_t> out;
+    if (r < 0) {
+        return out;
+    }
+    const Dist2 r2 = square(clampRadius(r));
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (dist2(points[i], q) <= r2) {
+            out.push_back(i);
+        }
+    }
+    return out;
+}
+
+std::vector<std::size_t> bruteForceBox(const std::vector<Point>& points, const Point& lo, const Point& hi) {
+    std::vector<std::size_t> out;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (inBox(points[i], lo, hi)) {
+            out.push_back(i);
+        }
+    }
+    return out;
+}
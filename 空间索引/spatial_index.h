@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../运算符重载/point.h"
+#include "../线程池/work_stealing_pool.h"
+
+/*
+核心定位: Point 集合上的空间索引，替代逐点暴力扫描的邻近查询
+- KdTree：批量构建的 2-d 树。按深度交替用 x / y 的中位数切分，节点隐式存放在重排后的数组中
+          （子树 = 数组中的一段连续区间），没有指针，内存 = 点 + 原始下标
+- UniformGrid：均匀网格。点按所在格子做计数排序，同一格子的点在内存中连续（CSR 布局）
+          适合点分布比较均匀、查询半径与格子大小相近的场景
+两者都支持：
+  1. k 近邻（kNN）        knn(q, k)           结果按距离从近到远排序
+  2. 半径查询              radius(q, r)        返回距离 <= r 的点（r 大于 2^33 时按 2^33 处理，已覆盖所有 int 坐标）
+  3. 矩形查询              box(lo, hi)         返回 lo.x <= x <= hi.x 且 lo.y <= y <= hi.y 的点
+  4. 批量查询              knnBatch(...)       传入线程池时用 parallel_for 并行执行
+构造函数可传入 WorkStealingPool*：KdTree 并行构建上层子树，UniformGrid 并行计算每个点的格子编号
+查询结果中的 index 是点在构造时传入数组中的下标
+*/
+
+// 查询结果：原始下标 + 距离平方
+// 内部用 128 位整数精确计算和比较；对外的 dist2 超过 UINT64_MAX 时饱和（相距约 4.29e9 以上才会出现）
+struct Neighbor {
+    std::size_t index;
+    std::uint64_t dist2;
+};
+
+namespace spatial_detail {
+
+// 点和它的原始下标放在一起：查询命中时不需要再访问第二个数组
+struct Entry {
+    Point point;
+    std::uint32_t id;
+};
+
+} // namespace spatial_detail
+
+// ===================== 一、k-d 树 =====================
+class KdTree {
+public:
+    // 叶子区间不超过 kLeafSize 个点时直接线性扫描
+    static constexpr std::size_t kLeafSize = 16;
+
+    // 子区间大于该值时，交给线程池并行构建
+    static constexpr std::size_t kParallelThreshold = 1 << 14;
+
+    explicit KdTree(const std::vector<Point>& points, WorkStealingPool* pool = nullptr);
+
+    std::size_t size() const { return m_entries_.size(); }
+
+    std::vector<Neighbor> knn(const Point& q, std::size_t k) const;
+    std::vector<std::size_t> radius(const Point& q, std::int64_t r) const;
+    std::vector<std::size_t> box(const Point& lo, const Point& hi) const;
+
+    std::vector<std::vector<Neighbor>> knnBatch(const std::vector<Point>& queries, std::size_t k,
+                                                WorkStealingPool* pool = nullptr) const;
+    std::vector<std::vector<std::size_t>> radiusBatch(const std::vector<Point>& queries, std::int64_t r,
+                                                      WorkStealingPool* pool = nullptr) const;
+
+    // 索引本身占用的字节数（不含 vector 的多余容量）
+    std::size_t memoryBytes() const { return m_entries_.size() * sizeof(spatial_detail::Entry); }
+
+private:
+    void build(std::size_t lo, std::size_t hi, unsigned depth, TaskGroup* group);
+
+    // 区间 [lo, hi) 的中点是切分节点：左半边坐标 <= 节点，右半边 >= 节点
+    std::vector<spatial_detail::Entry> m_entries_;
+};
+
+// ===================== 二、均匀网格 =====================
+class UniformGrid {
+public:
+    // cell_size 为 0 时自动选择：平均每个格子约 kTargetPerCell 个点
+    static constexpr std::size_t kTargetPerCell = 4;
+
+    explicit UniformGrid(const std::vector<Point>& points, std::int64_t cell_size = 0,
+                         WorkStealingPool* pool = nullptr);
+
+    std::size_t size() const { return m_entries_.size(); }
+    std::int64_t cellSize() const { return m_cell_; }
+    std::size_t cellCount() const { return static_cast<std::size_t>(m_cols_ * m_rows_); }
+
+    std::vector<Neighbor> knn(const Point& q, std::size_t k) const;
+    std::vector<std::size_t> radius(const Point& q, std::int64_t r) const;
+    std::vector<std::size_t> box(const Point& lo, const Point& hi) const;
+
+    std::vector<std::vector<Neighbor>> knnBatch(const std::vector<Point>& queries, std::size_t k,
+                                                WorkStealingPool* pool = nullptr) const;
+    std::vector<std::vector<std::size_t>> radiusBatch(const std::vector<Point>& queries, std::int64_t r,
+                                                      WorkStealingPool* pool = nullptr) const;
+
+    std::size_t memoryBytes() const {
+        return m_entries_.size() * sizeof(spatial_detail::Entry) +
+               m_cell_start_.size() * sizeof(std::uint32_t);
+    }
+
+private:
+    // 坐标 -> 格子坐标（越界时夹到网格边缘）
+    std::int64_t cellX(std::int64_t x) const;
+    std::int64_t cellY(std::int64_t y) const;
+
+    // 遍历第 row 行中第 [x0, x1] 个格子内的点：同一行相邻格子在内存中连续，只需一段区间
+    template<typename F>
+    void forEachInRow(std::int64_t row, std::int64_t x0, std::int64_t x1, F&& f) const {
+        const std::size_t base = static_cast<std::size_t>(row * m_cols_);
+        const std::uint32_t begin = m_cell_start_[base + static_cast<std::size_t>(x0)];
+        const std::uint32_t end = m_cell_start_[base + static_cast<std::size_t>(x1) + 1];
+        for (std::uint32_t i = begin; i < end; i++) {
+            f(m_entries_[i]);
+        }
+    }
+
+    std::int64_t m_min_x_ = 0;
+    std::int64_t m_min_y_ = 0;
+    std::int64_t m_cell_ = 1;
+    std::int64_t m_cols_ = 1;
+    std::int64_t m_rows_ = 1;
+    std::vector<std::uint32_t> m_cell_start_;            // 第 c 个格子的点位于 [start[c], start[c + 1])
+    std::vector<spatial_detail::Entry> m_entries_;       // 按格子（行优先）排序后的点
+};
+
+// ===================== 三、暴力扫描（基准对照组）=====================
+std::vector<Neighbor> bruteForceKnn(const std::vector<Point>& points, const Point& q, std::size_t k);
+std::vector<std::size_t> bruteForceRadius(const std::vector<Point>& points, const Point& q, std::int64_t r);
+std::vector<std::size_t> bruteForceBox(const std::vector<Point>& points, const Point& lo, const Point& hi);
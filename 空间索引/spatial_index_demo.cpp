@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "spatial_index.h"
+
+/*
+核心定位: 演示 spatial_index.h：在 Point 集合上建 k-d 树 / 均匀网格，做 kNN、半径、矩形查询
+并与暴力扫描的结果逐一核对
+*/
+
+namespace {
+
+void printNeighbors(const std::vector<Point>& points, const std::vector<Neighbor>& result) {
+    for (const Neighbor& n : result) {
+        std::cout << "  #" << n.index << " " << points[n.index] << " 距离平方 " << n.dist2 << std::endl;
+    }
+}
+
+bool sameNeighbors(const std::vector<Neighbor>& a, const std::vector<Neighbor>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); i++) {
+        if (a[i].index != b[i].index || a[i].dist2 != b[i].dist2) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 半径 / 矩形查询不保证顺序，排序后再比较
+bool sameSet(std::vector<std::size_t> a, std::vector<std::size_t> b) {
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    return a == b;
+}
+
+} // namespace
+
+int main() {
+    std::cout << "===== 1. 小规模示例 =====" << std::endl;
+    std::vector<Point> points = {Point(2, 3), Point(5, 4), Point(9, 6), Point(4, 7),
+                                 Point(8, 1), Point(7, 2), Point(1, 1), Point(6, 6)};
+    KdTree tree(points);
+    UniformGrid grid(points);
+    Point q(6, 3);
+    std::cout << "查询点 " << q << " 的 3 个最近邻（k-d 树）:" << std::endl;
+    printNeighbors(points, tree.knn(q, 3));
+    std::cout << "查询点 " << q << " 的 3 个最近邻（均匀网格，格子边长 " << grid.cellSize() << "）:" << std::endl;
+    printNeighbors(points, grid.knn(q, 3));
+
+    std::cout << "半径 2 以内:";
+    for (std::size_t i : tree.radius(q, 2)) {
+        std::cout << " " << points[i];
+    }
+    std::cout << "\n矩形 [(4,2), (8,6)] 内:";
+    for (std::size_t i : grid.box(Point(4, 2), Point(8, 6))) {
+        std::cout << " " << points[i];
+    }
+    std::cout << std::endl;
+
+    std::cout << "\n===== 2. 随机点集：并行构建 + 批量查询，与暴力扫描核对 =====" << std::endl;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> coord(-50000, 50000);
+    std::vector<Point> cloud;
+    for (int i = 0; i < 100000; i++) {
+        cloud.emplace_back(coord(rng), coord(rng));
+    }
+    std::vector<Point> queries;
+    for (int i = 0; i < 200; i++) {
+        queries.emplace_back(coord(rng) * 2, coord(rng));   // 一部分查询点落在点集范围之外
+    }
+
+    WorkStealingPool pool(4);
+    KdTree big_tree(cloud, &pool);
+    UniformGrid big_grid(cloud, 0, &pool);
+    std::cout << "点数 " << cloud.size() << "，网格 " << big_grid.cellCount() << " 格，"
+              << "索引内存: k-d 树 " << big_tree.memoryBytes() / 1024 << " KiB，网格 "
+              << big_grid.memoryBytes() / 1024 << " KiB" << std::endl;
+
+    auto tree_knn = big_tree.knnBatch(queries, 8, &pool);
+    auto grid_knn = big_grid.knnBatch(queries, 8, &pool);
+    auto tree_radius = big_tree.radiusBatch(queries, 1500, &pool);
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        auto expected = bruteForceKnn(cloud, queries[i], 8);
+        mismatches += !sameNeighbors(tree_knn[i], expected);
+        mismatches += !sameNeighbors(grid_knn[i], expected);
+        auto in_radius = bruteForceRadius(cloud, queries[i], 1500);
+        mismatches += !sameSet(tree_radius[i], in_radius);
+        mismatches += !sameSet(big_grid.radius(queries[i], 1500), in_radius);
+        Point lo(queries[i].x() - 2000, queries[i].y() - 1000);
+        Point hi(queries[i].x() + 2000, queries[i].y() + 1000);
+        auto in_box = bruteForceBox(cloud, lo, hi);
+        mismatches += !sameSet(big_tree.box(lo, hi), in_box);
+        mismatches += !sameSet(big_grid.box(lo, hi), in_box);
+    }
+    std::cout << queries.size() << " 个查询 × 6 种组合，与暴力扫描不一致: " << mismatches << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
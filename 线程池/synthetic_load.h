@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+/*
+核心定位: parallel_for 扩展性测试用的合成负载
+thread_pool.cpp 的演示基准和 benchmark/bench_work_stealing_pool.cpp 共用，保证两处测的是同一种负载
+*/
+
+namespace synthetic_load {
+
+// 每个元素的计算量：cost 次浮点运算，防止被编译器优化掉
+inline double burn(std::size_t cost) {
+    double x = 0.0;
+    for (std::size_t k = 0; k < cost; k++) {
+        x += std::sqrt(static_cast<double>(k) + x);
+    }
+    return x;
+}
+
+// uniform：每个元素开销相同；skewed：开销集中在前 1/16 的元素上（总量相同）
+inline std::vector<std::size_t> makeCosts(std::size_t n, bool skewed) {
+    std::vector<std::size_t> costs(n, 200);
+    if (skewed) {
+        for (std::size_t i = 0; i < n; i++) {
+            costs[i] = (i < n / 16) ? 200 * 16 : 0;
+        }
+    }
+    return costs;
+}
+
+} // namespace synthetic_load
@@ -0,0 +1,97 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <stdexcept>
+#include "work_stealing_pool.h"
+#include "synthetic_load.h"
+
+/*
+核心定位: 演示 work_stealing_pool.h 的 TaskGroup / parallel_for，
+并测量均匀负载和倾斜负载下随线程数变化的加速比
+编译：g++ -std=c++17 -O2 -pthread thread_pool.cpp -o thread_pool
+*/
+
+// ===================== 一、基本用法 =====================
+void demonstrateBasicUsage() {
+    WorkStealingPool pool(4);
+
+    std::cout << "===== TaskGroup：提交一组任务并等待 =====" << std::endl;
+    std::atomic<int> sum{0};
+    TaskGroup group(pool);
+    for (int i = 1; i <= 100; i++) {
+        group.run([&sum, i] { sum += i; });
+    }
+    group.wait();
+    std::cout << "1 + 2 + ... + 100 = " << sum << std::endl;
+
+    std::cout << "\n===== parallel_for：并行填充数组 =====" << std::endl;
+    std::vector<int> squares(10);
+    parallel_for(pool, 0, squares.size(), [&squares](std::size_t i) {
+        squares[i] = static_cast<int>(i * i);
+    });
+    for (int v : squares) {
+        std::cout << v << " ";
+    }
+    std::cout << std::endl;
+
+    std::cout << "\n===== TaskGroup：任务抛出的异常由 wait() 重新抛出 =====" << std::endl;
+    TaskGroup failing(pool);
+    for (int i = 0; i < 4; i++) {
+        failing.run([i] {
+            if (i == 2) {
+                throw std::runtime_error("任务 2 失败");
+            }
+        });
+    }
+    try {
+        failing.wait();
+    } catch (const std::runtime_error& e) {
+        std::cout << "捕获异常: " << e.what() << std::endl;
+    }
+}
+
+// ===================== 二、扩展性基准 =====================
+using synthetic_load::burn;
+using synthetic_load::makeCosts;
+
+void benchmarkScaling() {
+    std::cout << "\n===== 基准：parallel_for 扩展性 =====" << std::endl;
+    std::cout << "硬件线程数: " << std::thread::hardware_concurrency() << std::endl;
+    const std::size_t kElements = 20000;
+
+    for (bool skewed : {false, true}) {
+        std::vector<std::size_t> costs = makeCosts(kElements, skewed);
+        std::vector<double> out(kElements);
+
+        // 串行基线
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < kElements; i++) {
+            out[i] = burn(costs[i]);
+        }
+        double serial_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cout << (skewed ? "[倾斜负载]" : "[均匀负载]") << " 串行: " << std::fixed << std::setprecision(2)
+                  << serial_ms << " ms" << std::endl;
+
+        for (std::size_t threads : {1, 2, 4, 8}) {
+            WorkStealingPool pool(threads);
+            start = std::chrono::steady_clock::now();
+            parallel_for(pool, 0, kElements, [&](std::size_t i) { out[i] = burn(costs[i]); });
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            WorkStealingPool::Stats s = pool.stats();
+            std::cout << "  线程 " << threads
+                      << "  耗时 " << std::setw(8) << ms << " ms"
+                      << "  加速比 " << std::setw(5) << serial_ms / ms
+                      << "  任务 " << s.tasks_executed
+                      << "  窃取 " << s.steals
+                      << "  空闲 " << s.idle_ns / 1000000.0 << " ms"
+                      << "  最大队列深度 " << s.queue_depth_max << std::endl;
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    demonstrateBasicUsage();
+    benchmarkScaling();
+    return 0;
+}
@@ -0,0 +1,327 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/*
+核心定位: 工作窃取（work-stealing）线程池
+1. 每个工作线程一个双端队列：自己从尾部取（LIFO，缓存友好），空闲线程从别人的头部偷（FIFO，偷大块任务）
+2. TaskGroup：一组任务 + wait()，等待期间当前线程也会参与执行任务（不会因等待而占着线程不干活）
+   任务抛出的第一个异常被保存下来，由 wait() 重新抛出（与 std::future::get 相同）
+3. parallel_for：对下标区间 [begin, end) 做自适应切分（lazy binary splitting）
+   只有当本线程队列空了（说明别的线程可能在饿着）才继续对半拆分，否则直接顺序执行
+4. 统计计数：窃取次数、空闲时间、队列深度，用于观察负载是否均衡
+*/
+
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    // 统计快照：前四项为累计值，queue_depth_max 为出现过的最大单队列深度，
+    // queue_depth_now 为所有队列中尚未开始执行的任务总数
+    struct Stats {
+        std::uint64_t tasks_executed = 0;
+        std::uint64_t steals = 0;
+        std::uint64_t failed_steals = 0;
+        std::uint64_t idle_ns = 0;
+        std::size_t queue_depth_max = 0;
+        std::size_t queue_depth_now = 0;
+    };
+
+    explicit WorkStealingPool(std::size_t threads = std::thread::hardware_concurrency())
+        : m_queues_(std::max<std::size_t>(threads, 1)) {
+        for (std::size_t i = 0; i < m_queues_.size(); ++i) {
+            m_workers_.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    // 析构：先把剩余任务执行完，再通知线程退出
+    ~WorkStealingPool() {
+        while (m_pending_.load(std::memory_order_acquire) > 0) {
+            if (!tryRunOne()) {
+                std::this_thread::yield();
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex_);
+            m_stop_ = true;
+        }
+        m_sleep_cv_.notify_all();
+        for (auto& t : m_workers_) {
+            t.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    std::size_t size() const { return m_workers_.size(); }
+
+    // 提交任务：工作线程内部提交到自己的队列，外部线程轮流投递到各个队列
+    void submit(Task task) {
+        std::size_t index = (t_pool_ == this) ? t_index_
+                          : m_next_queue_.fetch_add(1, std::memory_order_relaxed) % m_queues_.size();
+        WorkerQueue& q = m_queues_[index];
+        {
+            std::lock_guard<std::mutex> lock(q.mutex);
+            q.tasks.push_back(std::move(task));
+            updateMax(m_queue_depth_max_, q.tasks.size());
+        }
+        m_pending_.fetch_add(1, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex_);  // 与 wait 的谓词检查同步，避免丢失唤醒
+        }
+        m_sleep_cv_.notify_one();
+    }
+
+    // 尝试执行一个任务：先取自己的队列，再从其他队列窃取；没有任务时返回 false
+    bool tryRunOne() {
+        Task task;
+        const bool is_worker = (t_pool_ == this);
+        const std::size_t self = is_worker ? t_index_ : 0;
+        if (is_worker && popLocal(self, task)) {
+            runTask(task);
+            return true;
+        }
+        const std::size_t n = m_queues_.size();
+        for (std::size_t k = 0; k < n; ++k) {
+            const std::size_t victim = (self + 1 + k) % n;
+            if (is_worker && victim == self) {
+                continue;
+            }
+            if (steal(victim, task)) {
+                if (is_worker) {
+                    m_steals_.fetch_add(1, std::memory_order_relaxed);
+                }
+                runTask(task);
+                return true;
+            }
+        }
+        if (is_worker) {
+            m_failed_steals_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return false;
+    }
+
+    // 当前线程自己队列的深度（非工作线程返回 0），供 parallel_for 判断是否继续拆分
+    std::size_t localDepth() {
+        if (t_pool_ != this) {
+            return 0;
+        }
+        WorkerQueue& q = m_queues_[t_index_];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        return q.tasks.size();
+    }
+
+    Stats stats() const {
+        Stats s;
+        s.tasks_executed = m_tasks_executed_.load(std::memory_order_relaxed);
+        s.steals = m_steals_.load(std::memory_order_relaxed);
+        s.failed_steals = m_failed_steals_.load(std::memory_order_relaxed);
+        s.idle_ns = m_idle_ns_.load(std::memory_order_relaxed);
+        s.queue_depth_max = m_queue_depth_max_.load(std::memory_order_relaxed);
+        s.queue_depth_now = m_pending_.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    void resetStats() {
+        m_tasks_executed_ = 0;
+        m_steals_ = 0;
+        m_failed_steals_ = 0;
+        m_idle_ns_ = 0;
+        m_queue_depth_max_ = 0;
+    }
+
+private:
+    // 每个队列独占缓存行，避免相邻队列的锁互相伪共享
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    bool popLocal(std::size_t index, Task& out) {
+        WorkerQueue& q = m_queues_[index];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.tasks.empty()) {
+            return false;
+        }
+        out = std::move(q.tasks.back());
+        q.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(std::size_t victim, Task& out) {
+        WorkerQueue& q = m_queues_[victim];
+        std::unique_lock<std::mutex> lock(q.mutex, std::try_to_lock);  // 抢不到锁就换下一个受害者
+        if (!lock.owns_lock() || q.tasks.empty()) {
+            return false;
+        }
+        out = std::move(q.tasks.front());
+        q.tasks.pop_front();
+        return true;
+    }
+
+    void runTask(Task& task) {
+        m_pending_.fetch_sub(1, std::memory_order_acq_rel);
+        task();
+        m_tasks_executed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void workerLoop(std::size_t index) {
+        t_pool_ = this;
+        t_index_ = index;
+        for (;;) {
+            if (tryRunOne()) {
+                continue;
+            }
+            auto idle_start = std::chrono::steady_clock::now();
+            {
+                std::unique_lock<std::mutex> lock(m_sleep_mutex_);
+                m_sleep_cv_.wait(lock, [this] {
+                    return m_stop_ || m_pending_.load(std::memory_order_acquire) > 0;
+                });
+                if (m_stop_ && m_pending_.load(std::memory_order_acquire) == 0) {
+                    return;
+                }
+            }
+            m_idle_ns_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now() - idle_start).count(),
+                                 std::memory_order_relaxed);
+        }
+    }
+
+    static void updateMax(std::atomic<std::size_t>& target, std::size_t value) {
+        std::size_t cur = target.load(std::memory_order_relaxed);
+        while (value > cur && !target.compare_exchange_weak(cur, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    std::vector<WorkerQueue> m_queues_;
+    std::vector<std::thread> m_workers_;
+
+    std::atomic<std::size_t> m_pending_{0};      // 已提交但尚未开始执行的任务数
+    std::atomic<std::size_t> m_next_queue_{0};   // 外部线程投递任务的轮转下标
+    std::mutex m_sleep_mutex_;
+    std::condition_variable m_sleep_cv_;
+    bool m_stop_ = false;
+
+    std::atomic<std::uint64_t> m_tasks_executed_{0};
+    std::atomic<std::uint64_t> m_steals_{0};
+    std::atomic<std::uint64_t> m_failed_steals_{0};
+    std::atomic<std::uint64_t> m_idle_ns_{0};
+    std::atomic<std::size_t> m_queue_depth_max_{0};
+
+    // 当前线程所属的线程池及其队列下标（非工作线程为 nullptr）
+    static inline thread_local WorkStealingPool* t_pool_ = nullptr;
+    static inline thread_local std::size_t t_index_ = 0;
+};
+
+// ===================== TaskGroup：一组任务 + wait() =====================
+class TaskGroup {
+public:
+    explicit TaskGroup(WorkStealingPool& pool) : m_pool_(pool) {}
+
+    // 析构前必须等待所有任务结束（任务捕获了 this）；析构中不再抛出任务的异常
+    ~TaskGroup() { waitAll(); }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template<typename F>
+    void run(F&& f) {
+        m_outstanding_.fetch_add(1, std::memory_order_relaxed);
+        m_pool_.submit([this, fn = std::forward<F>(f)]() mutable {
+            // 作用域守卫：fn 抛异常时同样要递减计数，否则 wait() 会永远等待
+            struct Done {
+                std::atomic<std::size_t>& outstanding;
+                ~Done() { outstanding.fetch_sub(1, std::memory_order_release); }
+            } done{m_outstanding_};
+            try {
+                fn();
+            } catch (...) {
+                // 异常不能逃出工作线程（否则 std::terminate），保存下来交给 wait()
+                std::lock_guard<std::mutex> lock(m_error_mutex_);
+                if (!m_error_) {
+                    m_error_ = std::current_exception();
+                }
+            }
+        });
+    }
+
+    // 等待期间帮忙执行任务：即使在工作线程里调用 wait() 也不会死锁
+    // 所有任务结束后，若有任务抛出过异常，重新抛出其中第一个
+    void wait() {
+        waitAll();
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(m_error_mutex_);
+            error = std::exchange(m_error_, nullptr);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    void waitAll() {
+        while (m_outstanding_.load(std::memory_order_acquire) > 0) {
+            if (!m_pool_.tryRunOne()) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    WorkStealingPool& m_pool_;
+    std::atomic<std::size_t> m_outstanding_{0};
+    std::mutex m_error_mutex_;
+    std::exception_ptr m_error_;
+};
+
+// ===================== parallel_for：自适应切分的并行循环 =====================
+namespace pool_detail {
+
+template<typename Body>
+void splitRange(WorkStealingPool& pool, TaskGroup& group, std::size_t begin, std::size_t end,
+                std::size_t grain, const Body& body) {
+    // 本线程队列里还有任务时说明拆出去的活还没被偷走，继续拆分没有意义，直接顺序执行
+    while (end - begin > grain && pool.localDepth() == 0) {
+        const std::size_t mid = begin + (end - begin) / 2;
+        group.run([&pool, &group, mid, end, grain, &body] {
+            splitRange(pool, group, mid, end, grain, body);
+        });
+        end = mid;
+    }
+    for (std::size_t i = begin; i < end; ++i) {
+        body(i);
+    }
+}
+
+} // namespace pool_detail
+
+// 对 [begin, end) 中每个下标调用 body(i)；grain 为最小块大小，0 表示自动选择
+template<typename Body>
+void parallel_for(WorkStealingPool& pool, std::size_t begin, std::size_t end, const Body& body,
+                  std::size_t grain = 0) {
+    if (begin >= end) {
+        return;
+    }
+    if (grain == 0) {
+        // 自动粒度：每个线程约 8 块，给窃取留出余量
+        grain = std::max<std::size_t>(1, (end - begin) / (pool.size() * 8));
+    }
+    TaskGroup group(pool);
+    pool_detail::splitRange(pool, group, begin, end, grain, body);
+    group.wait();
+}
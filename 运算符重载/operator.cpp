@@ -7,93 +7,8 @@
 本质是 “以函数形式实现运算符逻辑”，分为成员函数重载和全局函数重载两类。
 */
 
-// 成员函数重载（推荐用于单目 / 赋值类运算符）
-class Point {
-public:
-    Point(int x, int y) : x_(x), y_(y) {}
-
-    // 前置递增运算符：++p1，返回引用（高效，无临时对象）
-    Point& operator++() {
-        this->x_++;
-        this->y_++;
-        return *this;
-    }
-
-    // 后置递增运算符：p1++，返回旧值的副本（有临时对象开销）
-    // 注意：参数 int 仅用于区分前置和后置，不实际使用
-    Point operator++(int) {
-        Point old = *this;  // 保存旧值
-        this->x_++;
-        this->y_++;
-        return old;  // 返回旧值（临时对象）
-    }
-
-    // 成员函数重载（双目）：左操作数必须是当前类对象
-    // 用途：Point + Point
-    Point operator+(const Point& other) const {
-        return Point(x_ + other.x_, y_ + other.y_);
-    }
-
-    // ===================== 友元函数（friend）的作用 =====================
-    // 问题：全局函数无法直接访问类的私有成员（x_、y_）
-    // 解决：在类内声明 friend，授予全局函数访问私有成员的权限
-    // 
-    // friend 的作用：
-    // 1. 允许全局函数访问类的私有/受保护成员
-    // 2. 不影响类的封装性（友元是"受控的例外"）
-    // 3. 常用于运算符重载（如流运算符 <<、>> 必须用全局函数）
-    // 
-    // 注意：friend 声明在类内，但函数定义在类外（全局作用域）
-    friend Point operator+(const Point& lhs, int delta);
-    friend Point operator+(int delta, const Point& rhs);
-    
-    // 流运算符 << 必须用全局函数重载（因为左操作数是 ostream，不是 Point）
-    // 需要 friend 才能访问私有成员 x_、y_
-    friend std::ostream& operator<<(std::ostream& os, const Point& p);
-
-    void print() const {
-        std::cout << "Point x " << x_ << " y " << y_ << std::endl;
-    }
-
-private:
-    int x_;
-    int y_;
-};
-
-// ===================== 全局函数重载（需要 friend 才能访问私有成员）=====================
-// 全局函数重载：Point + int
-// 注意：这里能访问 lhs.x_ 和 lhs.y_，是因为在 Point 类中声明了 friend
-// 如果没有 friend 声明，这里会编译错误：无法访问私有成员
-Point operator+(const Point& lhs, int delta) {
-    return Point(lhs.x_ + delta, lhs.y_ + delta);  // ✅ 可以访问私有成员（因为有 friend）
-}
-
-// 全局函数重载：int + Point
-Point operator+(int delta, const Point& rhs) {
-    return Point(rhs.x_ + delta, rhs.y_ + delta);  // ✅ 可以访问私有成员（因为有 friend）
-}
-
-// ===================== 流运算符重载（典型友元函数应用）=====================
-// 流运算符 << 必须用全局函数，因为左操作数是 std::ostream，不是 Point
-// 需要 friend 才能访问 Point 的私有成员
-std::ostream& operator<<(std::ostream& os, const Point& p) {
-    os << "Point(" << p.x_ << ", " << p.y_ << ")";  // ✅ 可以访问私有成员（因为有 friend）
-    return os;  // 返回流引用，支持链式调用：cout << p1 << p2
-}
-
-/*
-// ===================== 如果没有 friend 会怎样？=====================
-// 错误示例：如果删除 friend 声明，下面的代码会编译失败
-Point operator+(const Point& lhs, int delta) {
-    // ❌ 编译错误：'x_' 是 Point 类的私有成员，无法访问
-    // return Point(lhs.x_ + delta, lhs.y_ + delta);
-    
-    // 解决方案1：使用公有接口（如果有的话）
-    // return Point(lhs.getX() + delta, lhs.getY() + delta);
-    
-    // 解决方案2：在类内声明 friend（推荐，性能更好）
-}
-*/
+// Point 类定义在 point.h 中，全局运算符重载实现在 point.cpp 中
+#include "point.h"
 
 int main(int argc, char* argv[]) {
     Point p1(1, 2);
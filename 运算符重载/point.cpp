@@ -0,0 +1,36 @@
+#include "point.h"
+
+// ===================== 全局函数重载（需要 friend 才能访问私有成员）=====================
+// 全局函数重载：Point + int
+// 注意：这里能访问 lhs.x_ 和 lhs.y_，是因为在 Point 类中声明了 friend
+// 如果没有 friend 声明，这里会编译错误：无法访问私有成员
+Point operator+(const Point& lhs, int delta) {
+    return Point(lhs.x_ + delta, lhs.y_ + delta);  // ✅ 可以访问私有成员（因为有 friend）
+}
+
+// 全局函数重载：int + Point
+Point operator+(int delta, const Point& rhs) {
+    return Point(rhs.x_ + delta, rhs.y_ + delta);  // ✅ 可以访问私有成员（因为有 friend）
+}
+
+// ===================== 流运算符重载（典型友元函数应用）=====================
+// 流运算符 << 必须用全局函数，因为左操作数是 std::ostream，不是 Point
+// 需要 friend 才能访问 Point 的私有成员
+std::ostream& operator<<(std::ostream& os, const Point& p) {
+    os << "Point(" << p.x_ << ", " << p.y_ << ")";  // ✅ 可以访问私有成员（因为有 friend）
+    return os;  // 返回流引用，支持链式调用：cout << p1 << p2
+}
+
+/*
+// ===================== 如果没有 friend 会怎样？=====================
+// 错误示例：如果删除 friend 声明，下面的代码会编译失败
+Point operator+(const Point& lhs, int delta) {
+    // ❌ 编译错误：'x_' 是 Point 类的私有成员，无法访问
+    // return Point(lhs.x_ + delta, lhs.y_ + delta);
+    
+    // 解决方案1：使用公有接口（如果有的话）
+    // return Point(lhs.getX() + delta, lhs.getY() + delta);
+    
+    // 解决方案2：在类内声明 friend（推荐，性能更好）
+}
+*/
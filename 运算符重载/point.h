@@ -0,0 +1,62 @@
+#pragma once
+
+#include <iostream>
+
+// 成员函数重载（推荐用于单目 / 赋值类运算符）
+class Point {
+public:
+    Point(int x, int y) : x_(x), y_(y) {}
+
+    // 前置递增运算符：++p1，返回引用（高效，无临时对象）
+    Point& operator++() {
+        this->x_++;
+        this->y_++;
+        return *this;
+    }
+
+    // 后置递增运算符：p1++，返回旧值的副本（有临时对象开销）
+    // 注意：参数 int 仅用于区分前置和后置，不实际使用
+    Point operator++(int) {
+        Point old = *this;  // 保存旧值
+        this->x_++;
+        this->y_++;
+        return old;  // 返回旧值（临时对象）
+    }
+
+    // 成员函数重载（双目）：左操作数必须是当前类对象
+    // 用途：Point + Point
+    Point operator+(const Point& other) const {
+        return Point(x_ + other.x_, y_ + other.y_);
+    }
+
+    // ===================== 友元函数（friend）的作用 =====================
+    // 问题：全局函数无法直接访问类的私有成员（x_、y_）
+    // 解决：在类内声明 friend，授予全局函数访问私有成员的权限
+    // 
+    // friend 的作用：
+    // 1. 允许全局函数访问类的私有/受保护成员
+    // 2. 不影响类的封装性（友元是"受控的例外"）
+    // 3. 常用于运算符重载（如流运算符 <<、>> 必须用全局函数）
+    // 
+    // 注意：friend 声明在类内，但函数定义在类外（全局作用域）
+    friend Point operator+(const Point& lhs, int delta);
+    friend Point operator+(int delta, const Point& rhs);
+    
+    // 流运算符 << 必须用全局函数重载（因为左操作数是 ostream，不是 Point）
+    // 需要 friend 才能访问私有成员 x_、y_
+    friend std::ostream& operator<<(std::ostream& os, const Point& p);
+
+    // 只读访问：空间索引等外部算法需要读取坐标
+    int x() const { return x_; }
+    int y() const { return y_; }
+
+    void print() const {
+        std::cout << "Point x " << x_ << " y " << y_ << std::endl;
+    }
+
+private:
+    int x_;
+    int y_;
+};
+
+// 全局运算符的定义见 point.cpp